@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Font.hpp"
+#include "SFML/Graphics/Glyph.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Path.hpp"
+#include "SFML/System/Time.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Look up 1M glyphs cycling through a set of characters,
+/// and return the average time per lookup in nanoseconds
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] double measure(const sf::Font& font, std::u32string_view characters, float outlineThickness)
+{
+    constexpr std::size_t lookupCount   = 1'000'000;
+    constexpr unsigned    characterSize = 24;
+
+    // Rasterize the glyphs first, only the lookups are measured
+    font.prewarm(characters, characterSize, /* bold */ false, outlineThickness);
+
+    float       checksum = 0.f;
+    std::size_t index    = 0;
+
+    const sf::Clock clock;
+
+    for (std::size_t i = 0; i < lookupCount; ++i)
+    {
+        checksum += font.getGlyph(characters[index], characterSize, /* bold */ false, outlineThickness).advance;
+
+        if (++index == characters.size())
+            index = 0;
+    }
+
+    const double elapsed = static_cast<double>(clock.getElapsedTime().asMicroseconds());
+
+    // Prevent the lookups from being optimized away
+    if (checksum < 0.f)
+        std::cout << checksum << '\n';
+
+    return elapsed * 1000.0 / static_cast<double>(lookupCount);
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    sf::GraphicsContext graphicsContext;
+
+    const auto font = sf::Font::openFromFile(graphicsContext, "resources/tuffy.ttf").value();
+
+    const std::u32string_view ascii    = U"The quick brown fox jumps over the lazy dog. 0123456789!?";
+    const std::u32string_view nonAscii = U"Größenmaßstäbe façade naïve déjà vu œuvre Ærøskøbing";
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "characters                    getGlyph (ns/call)\n";
+    std::cout << "ASCII                         " << std::setw(18) << measure(font, ascii, 0.f) << '\n';
+    std::cout << "ASCII, outlined               " << std::setw(18) << measure(font, ascii, 1.f) << '\n';
+    std::cout << "Non-ASCII                     " << std::setw(18) << measure(font, nonAscii, 0.f) << '\n';
+
+    return 0;
+}
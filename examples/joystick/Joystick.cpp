@@ -6,7 +6,6 @@
 #include "SFML/Graphics/CoordinateType.hpp"
 #include "SFML/Graphics/Font.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
-#include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderWindow.hpp"
 #include "SFML/Graphics/Text.hpp"
@@ -258,7 +257,7 @@ int main()
         states.texture        = &font.getTexture(characterSize);
         states.coordinateType = sf::CoordinateType::Pixels;
 
-        window.draw(batch.data(), batch.size(), sf::PrimitiveType::Triangles, states);
+        window.drawQuads(batch.data(), batch.size(), states);
 #endif
 
         // Display things on screen
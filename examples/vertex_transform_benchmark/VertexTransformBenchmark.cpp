@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexUtils.hpp"
+
+#include "SFML/System/Angle.hpp"
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Reference implementation, one vertex at a time
+///
+////////////////////////////////////////////////////////////
+void transformVerticesScalar(const sf::Transform& transform, const sf::Vertex* input, sf::Vertex* output, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        output[i].position  = transform * input[i].position;
+        output[i].color     = input[i].color;
+        output[i].texCoords = input[i].texCoords;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+/// Run a kernel enough times to process about 100M vertices,
+/// and return the average time per vertex in nanoseconds
+///
+////////////////////////////////////////////////////////////
+template <typename Kernel>
+[[nodiscard]] double measure(Kernel&& kernel, std::size_t vertexCount)
+{
+    const std::size_t iterations = 100'000'000 / vertexCount;
+
+    // Warm up the caches
+    kernel();
+
+    const sf::Clock clock;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+        kernel();
+
+    return static_cast<double>(clock.getElapsedTime().asMicroseconds()) * 1000.0 /
+           static_cast<double>(iterations * vertexCount);
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    sf::Transform transform;
+    transform.translate({100.f, 50.f}).rotate(sf::degrees(30.f)).scale({2.f, 0.5f});
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "vertices    scalar (ns/vertex)    transformVertices (ns/vertex)    speedup\n";
+
+    for (const std::size_t vertexCount : {std::size_t{1'000}, std::size_t{100'000}, std::size_t{1'000'000}})
+    {
+        std::vector<sf::Vertex> input(vertexCount);
+        std::vector<sf::Vertex> output(vertexCount);
+
+        for (std::size_t i = 0; i < vertexCount; ++i)
+            input[i].position = {static_cast<float>(i % 1024), static_cast<float>(i / 1024)};
+
+        const double scalarTime = measure([&]
+        { transformVerticesScalar(transform, input.data(), output.data(), vertexCount); }, vertexCount);
+
+        const double kernelTime = measure([&]
+        { sf::transformVertices(transform, input.data(), output.data(), vertexCount); }, vertexCount);
+
+        std::cout << std::setw(8) << vertexCount << std::setw(22) << scalarTime << std::setw(33) << kernelTime
+                  << std::setw(11) << scalarTime / kernelTime << "x\n";
+    }
+
+    return 0;
+}
@@ -14,6 +14,8 @@
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
 
+#include <string_view>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -42,6 +44,31 @@ struct Glyph;
 class SFML_GRAPHICS_API Font
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the glyphs loaded by the font
+    ///
+    /// The counters accumulate until `resetGlyphStatistics` is
+    /// called. The cache hit rate is `cacheHits / (cacheHits + cacheMisses)`.
+    /// The last three members describe the current state of the
+    /// cache, they are not affected by resets.
+    ///
+    /// \see getGlyphStatistics, resetGlyphStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] GlyphStatistics
+    {
+        std::size_t rasterizedGlyphs{}; //!< Number of glyphs rasterized by FreeType
+        std::size_t uploadedBytes{};    //!< Number of glyph pixel bytes uploaded to the page textures
+        std::size_t textureUploads{};   //!< Number of page texture updates issued
+        std::size_t cacheHits{};        //!< Number of glyph lookups served by the cache
+        std::size_t cacheMisses{};      //!< Number of glyph lookups that had to load the glyph
+        std::size_t evictedGlyphs{};    //!< Number of glyphs evicted from the cache to make room for new ones
+        std::size_t compactions{};      //!< Number of times an atlas was repacked after evicting glyphs
+        std::size_t pageCount{};        //!< Number of pages (character sizes) currently in the cache
+        std::size_t cachedGlyphs{};     //!< Number of glyphs currently in the cache
+        std::size_t textureBytes{};     //!< Size of the glyph textures currently allocated, in bytes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -51,6 +78,14 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
+    /// The copy has its own glyph tables, but shares the glyph
+    /// textures of \a rhs: the atlas of each character size, and
+    /// the shared atlas if enabled, are the same objects in both
+    /// fonts. Glyphs loaded by either font are added to the common
+    /// textures, and `setSmooth` on either font affects both.
+    /// A font that compacts a common texture makes the other one
+    /// load the glyphs it moved again on their next use.
+    ///
     ////////////////////////////////////////////////////////////
     Font(const Font& rhs);
 
@@ -63,6 +98,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Copy assignment
     ///
+    /// The glyph textures are shared with \a rhs, as with the
+    /// copy constructor.
+    ///
     ////////////////////////////////////////////////////////////
     Font& operator=(const Font& rhs);
 
@@ -155,7 +193,9 @@ public:
     /// exist, a font specific default is returned.
     ///
     /// Be aware that using a negative value for the outline
-    /// thickness will cause distorted rendering.
+    /// thickness will cause distorted rendering. The outline
+    /// thickness is ignored when distance field glyphs are
+    /// enabled, their outline is drawn by a shader instead.
     ///
     /// \param codePoint        Unicode code point of the character to get
     /// \param characterSize    Reference character size
@@ -170,6 +210,63 @@ public:
                                         bool          bold,
                                         float         outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a set of glyphs ahead of time
+    ///
+    /// Rasterizing a glyph the first time it is requested can
+    /// cause a hitch when a lot of new text appears at once (e.g.
+    /// a dialog in a language with many characters). Calling this
+    /// function during a loading screen avoids that cost later.
+    ///
+    /// \param characters       Unicode code points of the characters to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see prewarmInBackground
+    ///
+    ////////////////////////////////////////////////////////////
+    void prewarm(std::u32string_view characters, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a set of glyphs ahead of time, rasterizing them on a worker thread
+    ///
+    /// The worker thread opens its own FreeType face and only
+    /// rasterizes the glyphs. They are added to the font pages on
+    /// the calling thread, as they become available, by the next
+    /// calls to `getGlyph` or `getTexture` (which `sf::Text` calls
+    /// when drawn). Requesting a glyph that wasn't rasterized yet
+    /// simply loads it immediately, as usual.
+    ///
+    /// Only fonts opened from a file or from memory can be
+    /// rasterized in the background. For fonts opened from a
+    /// stream, the glyphs are loaded immediately, like `prewarm`.
+    ///
+    /// \param characters       Unicode code points of the characters to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \return True if the glyphs are being rasterized in the background, false if they were loaded immediately
+    ///
+    /// \see prewarm, isPrewarming
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool prewarmInBackground(std::u32string_view characters,
+                                           unsigned int        characterSize,
+                                           bool                bold             = false,
+                                           float               outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether glyphs rasterized in the background are still pending
+    ///
+    /// \return True if some glyphs requested with `prewarmInBackground` were not added to the font pages yet
+    ///
+    /// \see prewarmInBackground
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPrewarming() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -256,6 +353,13 @@ public:
     /// are requested, thus it is not very relevant. It is mainly
     /// used internally by sf::Text.
     ///
+    /// Glyphs are not uploaded to the texture when they are loaded,
+    /// but all at once when this function is called: the texture
+    /// only contains the glyphs loaded before the last call.
+    ///
+    /// When distance field glyphs or the shared atlas are enabled,
+    /// the same texture is returned for all the character sizes.
+    ///
     /// \param characterSize Reference character size
     ///
     /// \return Texture containing the glyphs of the requested size
@@ -289,7 +393,207 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable signed distance field glyphs
+    ///
+    /// In distance field mode, glyphs are rasterized once, at a
+    /// fixed reference size, as signed distance fields. A single
+    /// page then serves all the character sizes: `getGlyph` scales
+    /// the metrics to the requested size and `getTexture` returns
+    /// the same texture for every size. sf::Text draws such glyphs
+    /// with a dedicated shader, which keeps their edges sharp at
+    /// any scale and draws their outline without extra glyphs.
+    /// A shader passed in the render states of the text replaces
+    /// the dedicated one: it receives the raw distance field, in
+    /// the alpha channel of the texture (0.5 on the glyph edges),
+    /// and no outline is drawn.
+    ///
+    /// This saves glyph memory and rasterization time when text
+    /// is displayed at many sizes, or scaled. Small text is
+    /// slightly less crisp than with regular glyphs, which are
+    /// hinted for their exact size.
+    ///
+    /// Only scalable fonts support distance field glyphs.
+    /// Distance field glyphs are disabled by default.
+    ///
+    /// \param enabled True to enable distance field glyphs, false to disable them
+    ///
+    /// \see isDistanceFieldEnabled, getDistanceFieldSpread
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether signed distance field glyphs are enabled or not
+    ///
+    /// \return True if distance field glyphs are enabled, false if they are disabled
+    ///
+    /// \see setDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDistanceFieldEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the spread of the distance field glyphs
+    ///
+    /// The spread is the distance from the glyph outline at which
+    /// the distance field saturates. It is also the maximum outline
+    /// thickness that can be drawn around distance field glyphs.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Spread of the distance field at \a characterSize, in pixels
+    ///
+    /// \see setDistanceFieldEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDistanceFieldSpread(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the shared glyph atlas
+    ///
+    /// By default, each character size has its own texture, thus
+    /// texts of different sizes cannot be drawn in the same batch.
+    /// With the shared atlas, the glyphs of all the sizes and styles
+    /// are packed into a single texture: `getTexture` returns the
+    /// same texture for every size, and texts of mixed sizes can be
+    /// batched together. The atlas can also be shared with other
+    /// fonts, see `shareAtlasWith`.
+    ///
+    /// The glyphs loaded so far are discarded when the atlas
+    /// changes: references to them, and to the font textures,
+    /// are invalidated. Distance field glyphs, which already use
+    /// a single texture, are not affected.
+    /// The shared atlas is disabled by default.
+    ///
+    /// Copies of a font share its textures, whether the shared
+    /// atlas is enabled or not. Changing this setting on a copy
+    /// only affects the copy: it stops using the textures of the
+    /// original font and gets new ones.
+    ///
+    /// \param enabled True to enable the shared atlas, false to disable it
+    ///
+    /// \see isSharedAtlasEnabled, shareAtlasWith
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSharedAtlasEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the shared glyph atlas is enabled or not
+    ///
+    /// \return True if the shared atlas is enabled, false if it is disabled
+    ///
+    /// \see setSharedAtlasEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSharedAtlasEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pack the glyphs of this font into the atlas of another font
+    ///
+    /// Enables the shared atlas of \a other if needed, then makes
+    /// this font use it: texts using either font, at any size, are
+    /// drawn with the same texture and can be batched together.
+    /// Fonts sharing an atlas should have the same smooth filter.
+    ///
+    /// The glyphs loaded so far by this font are discarded, as
+    /// with `setSharedAtlasEnabled`.
+    ///
+    /// \param other Font whose atlas to use
+    ///
+    /// \see setSharedAtlasEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void shareAtlasWith(Font& other);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the memory budget of the glyph cache
+    ///
+    /// The glyph textures grow as new glyphs are loaded, until
+    /// they reach the maximum texture size, after which new glyphs
+    /// cannot be loaded anymore. The budget is enforced by
+    /// `compactGlyphCache`: loading glyphs never evicts other
+    /// glyphs, it only grows the textures, past the budget if
+    /// needed.
+    ///
+    /// \param budget Size of the glyph textures of the font, in bytes (0 for no budget)
+    ///
+    /// \see getGlyphCacheBudget, compactGlyphCache, getGlyphStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGlyphCacheBudget(std::size_t budget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory budget of the glyph cache
+    ///
+    /// \return Size of the glyph textures of the font, in bytes (0 for no budget)
+    ///
+    /// \see setGlyphCacheBudget
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getGlyphCacheBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict glyphs to bring the glyph textures back within the budget
+    ///
+    /// When the glyph textures are over the budget, the least
+    /// recently used glyphs are evicted, and the remaining ones
+    /// are packed again into smaller textures. Each character size
+    /// has its own texture, unless the shared atlas is enabled:
+    /// the glyphs of the least recently used sizes are evicted
+    /// first, and their textures shrunk back to 128x128 pixels.
+    /// These textures are only released with the font, so every
+    /// size in use keeps at least that much memory. The textures
+    /// which reached the maximum size are compacted regardless of
+    /// the budget, so that new glyphs can be loaded again.
+    ///
+    /// Compacting a texture moves the glyphs it keeps, and replaces
+    /// the texture: call this function at a point where no batched
+    /// or deferred draw call using the font is pending, e.g. at the
+    /// beginning of a frame or after `display`. Texts are laid out
+    /// again on their next draw, loading the glyphs they use again
+    /// if they were evicted.
+    ///
+    /// References to the evicted glyphs previously returned by
+    /// `getGlyph` are invalidated. References to the other glyphs
+    /// stay valid, their texture rectangle is updated in place.
+    ///
+    /// \see setGlyphCacheBudget, getGlyphStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void compactGlyphCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the glyph statistics accumulated since the last reset
+    ///
+    /// Calling `resetGlyphStatistics` once per frame allows
+    /// measuring the number of glyphs rasterized and the texture
+    /// bandwidth used by text in each frame.
+    ///
+    /// \return Glyph statistics of the font
+    ///
+    /// \see resetGlyphStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const GlyphStatistics& getGlyphStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset all the glyph statistics counters to zero
+    ///
+    /// \see getGlyphStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetGlyphStatistics();
+
 private:
+    friend Text;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the graphics context the font was opened with (used by sf::Text)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] GraphicsContext& getGraphicsContext() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the index of the internal representation a character
     ///
@@ -298,6 +602,12 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] unsigned int getCharIndex(std::uint32_t codePoint) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining a texture holding glyphs
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Atlas;
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
     ///
@@ -314,6 +624,40 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Page& loadPage(GraphicsContext& graphicsContext, unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Find or create the page holding the distance field glyphs
+    ///
+    /// \return The distance field glyphs page, shared by all character sizes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Page& loadDistanceFieldPage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a distance field glyph, scaled to a character size
+    ///
+    /// \param codePoint     Unicode code point of the character to get
+    /// \param characterSize Reference character size
+    /// \param bold          Retrieve the bold version or the regular one?
+    ///
+    /// \return The glyph corresponding to \a codePoint, with metrics scaled to \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Glyph& getDistanceFieldGlyph(std::uint32_t codePoint,
+                                                     unsigned int  characterSize,
+                                                     bool          bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixels and metrics of a glyph, rasterized but not yet added to a page
+    ///
+    ////////////////////////////////////////////////////////////
+    struct RasterizedGlyph;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Glyphs being rasterized on a worker thread
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PrewarmJob;
+
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
     ///
@@ -327,16 +671,63 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the pixels of a rasterized glyph to a page
+    ///
+    /// \param page            Page of glyphs to add the glyph to
+    /// \param rasterizedGlyph Glyph to add to the page
+    ///
+    /// \return The glyph, with its texture rectangle in the page
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Glyph insertGlyph(Page& page, const RasterizedGlyph& rasterizedGlyph) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the glyphs rasterized in the background so far to their pages
+    ///
+    ////////////////////////////////////////////////////////////
+    void collectPrewarmedGlyphs() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
     ///
-    /// \param page Page of glyphs to search in
-    /// \param size Width and height of the rectangle
+    /// \param atlas Atlas of glyphs to search in
+    /// \param size  Width and height of the rectangle
     ///
     /// \return Found rectangle within the texture
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] IntRect findGlyphRect(GraphicsContext& graphicsContext, Page& page, Vector2u size) const;
+    [[nodiscard]] IntRect findGlyphRect(GraphicsContext& graphicsContext, Atlas& atlas, Vector2u size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the least recently used glyphs of an atlas, and pack the remaining ones again
+    ///
+    /// \param atlas       Atlas of glyphs to compact
+    /// \param targetBytes Size of the glyphs to keep
+    ///
+    ////////////////////////////////////////////////////////////
+    void compactAtlas(Atlas& atlas, std::size_t targetBytes) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the textures of all the pages, each shared atlas counted once
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTextureBytes() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Account for an atlas resized by the font in the size of its textures
+    ///
+    /// \param atlas    Atlas that was resized
+    /// \param oldBytes Size of the atlas before it was resized
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTextureBytes(const Atlas& atlas, std::size_t oldBytes) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the pages of all the character sizes, along with their glyphs
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearPages();
 
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
@@ -367,7 +758,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 256> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
 
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
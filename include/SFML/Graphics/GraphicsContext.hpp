@@ -23,8 +23,10 @@ class RenderTextureImplFBO;
 
 namespace sf
 {
+class RenderTarget;
 class Shader;
 class Texture;
+struct Color;
 } // namespace sf
 
 
@@ -41,9 +43,12 @@ public:
     ~GraphicsContext();
 
     [[nodiscard]] Shader&  getBuiltInShader();
+    [[nodiscard]] Shader&  getBuiltInInstancedShader();
+    [[nodiscard]] Shader&  getBuiltInDistanceFieldShader();
     [[nodiscard]] Texture& getBuiltInWhiteDotTexture();
 
 private:
+    friend RenderTarget;
     friend Shader;
     friend priv::RenderTextureImplDefault;
     friend priv::RenderTextureImplFBO;
@@ -53,11 +58,44 @@ private:
     [[nodiscard]] const char* getBuiltInShaderVertexSrc() const;
     [[nodiscard]] const char* getBuiltInShaderFragmentSrc() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the outline drawn by the built-in distance field shader
+    ///
+    /// Called by render targets right before drawing with the
+    /// shader, with the outline of the render states of the draw
+    /// call. The uniforms are only updated when the outline changes.
+    ///
+    /// \param thickness Outline thickness, in distance field units (0.5 is the whole spread)
+    /// \param color     Outline color
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBuiltInDistanceFieldOutline(float thickness, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader program bound to the active OpenGL context
+    ///
+    /// The binding is tracked on the CPU, which avoids querying
+    /// `GL_CURRENT_PROGRAM` and stalling the pipeline. It is only
+    /// accurate if programs are bound through `sf::Shader`.
+    ///
+    /// \return OpenGL handle of the bound program, 0 if none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getActiveThreadLocalGlContextProgram() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the shader program bound to the active OpenGL context
+    ///
+    /// \param program OpenGL handle of the bound program, 0 if none
+    ///
+    ////////////////////////////////////////////////////////////
+    void setActiveThreadLocalGlContextProgram(unsigned int program);
+
     ////////////////////////////////////////////////////////////
     /// Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 512> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 768> m_impl; //!< Implementation details
 };
 
 } // namespace sf
@@ -263,6 +263,22 @@ public:
     ////////////////////////////////////////////////////////////
     void flipVertically();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a half-size copy of the image
+    ///
+    /// Each pixel of the result is the average of a 2x2 block of
+    /// pixels (box filter), which is how mipmap levels are built.
+    /// Colors are weighted by their alpha, so that transparent
+    /// pixels don't darken the edges of opaque areas.
+    ///
+    /// Odd sizes are rounded down, and sizes never go below 1:
+    /// a 5x1 image becomes 2x1, a 1x1 image stays 1x1.
+    ///
+    /// \return Downsampled image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image createDownsampled() const;
+
     ////////////////////////////////////////////////////////////
     /// \private
     ///
@@ -273,6 +289,17 @@ public:
     [[nodiscard]] Image(base::PassKey<Image>&&, Vector2u size, VectorArgs&&... vectorArgs);
 
 private:
+    friend class TextureReadback;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a writable pointer to the array of pixels
+    ///
+    /// Allows filling a new image in place, without going
+    /// through an intermediate array of pixels.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint8_t* getMutablePixelsPtr();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
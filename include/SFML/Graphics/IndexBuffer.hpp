@@ -0,0 +1,261 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/VertexBuffer.hpp"
+
+#include <cstddef>
+
+
+namespace sf
+{
+class GraphicsContext;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Index buffer storage, used along with a vertex buffer
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Type of a single index
+    ///
+    ////////////////////////////////////////////////////////////
+    using IndexType = unsigned int;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// \see sf::VertexBuffer::Usage
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit IndexBuffer(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IndexBuffer with a specific usage specifier
+    ///
+    /// Creates an empty index buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit IndexBuffer(GraphicsContext& graphicsContext, Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param rhs instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer& rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// Creates the index buffer and allocates enough graphics
+    /// memory to hold \p indexCount indices. Any previously
+    /// allocated memory is freed in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as \p indexCount. Don't forget to recreate with a non-zero
+    /// value when graphics memory should be allocated again.
+    ///
+    /// \param indexCount Number of indices worth of memory to allocate
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of indices
+    ///
+    /// The \a index array is assumed to have the same size as
+    /// the \a created buffer.
+    ///
+    /// This function does nothing if \a indices is null or if the
+    /// buffer was not previously created.
+    ///
+    /// \param indices Array of indices to copy to the buffer
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexType* indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of indices
+    ///
+    /// \p offset is specified as the number of indices to skip
+    /// from the beginning of the buffer. The update rules are the
+    /// same as the ones of `sf::VertexBuffer::update`: if \p offset
+    /// is 0 and \p indexCount is greater than the size of the
+    /// currently created buffer, a new buffer is created, while if
+    /// \p offset is not 0 and the range does not fit, the update fails.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexType* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the contents of another buffer into this buffer
+    ///
+    /// \param indexBuffer Index buffer whose contents to copy into this index buffer
+    ///
+    /// \return True if the copy was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexBuffer& indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param rhs Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer& rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this index buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(IndexBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the index buffer.
+    ///
+    /// \return OpenGL handle of the index buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this index buffer
+    ///
+    /// After changing the usage specifier, the index buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is sf::VertexBuffer::Usage::Stream.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this index buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind an index buffer for rendering
+    ///
+    /// The index buffer binding is part of the state of the
+    /// currently bound vertex array object.
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix sf::IndexBuffer with OpenGL code.
+    ///
+    /// \param indexBuffer Pointer to the index buffer to bind, can be null to use no index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(GraphicsContext& graphicsContext, const IndexBuffer* indexBuffer);
+
+private:
+    friend RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext* m_graphicsContext;      //!< The window context
+    unsigned int     m_buffer{};             //!< Internal buffer identifier
+    std::size_t      m_size{};               //!< Size in indices of the currently allocated buffer
+    Usage            m_usage{Usage::Stream}; //!< How this index buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one index buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(IndexBuffer& left, IndexBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// sf::IndexBuffer is a simple wrapper around a dynamic
+/// buffer of vertex indices, stored in graphics memory.
+///
+/// It is the companion of sf::VertexBuffer: when drawn together,
+/// the primitives are assembled by fetching the vertices in the
+/// order given by the indices, which allows vertices shared by
+/// multiple primitives (e.g. the corners of adjacent quads) to
+/// be stored and transferred only once.
+///
+/// Example:
+/// \code
+/// sf::Vertex vertices[4];
+/// const sf::IndexBuffer::IndexType indices[]{0, 1, 2, 2, 1, 3};
+/// ...
+/// sf::VertexBuffer quad(graphicsContext, sf::PrimitiveType::Triangles);
+/// quad.create(4);
+/// quad.update(vertices);
+///
+/// sf::IndexBuffer quadIndices(graphicsContext);
+/// quadIndices.create(6);
+/// quadIndices.update(indices);
+/// ...
+/// window.draw(quad, quadIndices);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::RenderTarget::drawQuads
+///
+////////////////////////////////////////////////////////////
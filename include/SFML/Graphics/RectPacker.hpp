@@ -0,0 +1,128 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Incremental packer of rectangles into a 2D area,
+///        using the skyline bottom-left heuristic
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RectPacker
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packer
+    ///
+    /// \param size Size of the area in which rectangles are packed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit RectPacker(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find room for a new rectangle
+    ///
+    /// The rectangle is placed where its bottom edge is the
+    /// smallest (`position.y + rectSize.y`, y pointing down), then
+    /// leftmost, and the space it covers is never returned again
+    /// until `clear` is called.
+    ///
+    /// \param rectSize Size of the rectangle to pack
+    ///
+    /// \return Position of the rectangle, or `base::nullOpt` if it does not fit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Vector2u> pack(Vector2u rectSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enlarge the area, keeping the rectangles already packed
+    ///
+    /// Sizes smaller than the current one on either axis are
+    /// ignored on that axis, the area never shrinks.
+    ///
+    /// \param size New size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all the packed rectangles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the area
+    ///
+    /// \return Size of the area in which rectangles are packed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal segment of the skyline
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Segment
+    {
+        unsigned int x;     //!< Left edge of the segment
+        unsigned int y;     //!< Height of the skyline over the segment
+        unsigned int width; //!< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Merge adjacent segments of equal height
+    ///
+    ////////////////////////////////////////////////////////////
+    void mergeSegments();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;    //!< Size of the packing area
+    std::vector<Segment> m_skyline; //!< Top outline of the packed rectangles, sorted from left to right
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RectPacker
+/// \ingroup graphics
+///
+/// sf::RectPacker decides where rectangles go in a bounded
+/// 2D area, without touching any pixel or graphics resource.
+/// It is the allocator behind sf::TextureAtlas, and can be
+/// used directly to lay out custom texture pages.
+///
+/// The packer tracks the "skyline" formed by the bottom edges
+/// of the rectangles packed so far (y pointing down), and places
+/// every new rectangle where its own bottom edge is the smallest,
+/// which keeps the skyline flat. This works well for rectangles
+/// arriving one at a time (e.g. images loaded at runtime), and
+/// the area can be enlarged at any time with `grow`.
+///
+/// Example:
+/// \code
+/// sf::RectPacker packer({256u, 256u});
+///
+/// if (const sf::base::Optional position = packer.pack({32u, 48u}))
+///     texture.update(pixels, {32u, 48u}, *position);
+/// \endcode
+///
+/// \see sf::TextureAtlas
+///
+////////////////////////////////////////////////////////////
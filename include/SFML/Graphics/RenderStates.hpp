@@ -7,6 +7,7 @@
 #include "SFML/Graphics/Export.hpp"
 
 #include "SFML/Graphics/BlendMode.hpp"
+#include "SFML/Graphics/Color.hpp"
 #include "SFML/Graphics/CoordinateType.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
 #include "SFML/Graphics/Transform.hpp"
@@ -112,6 +113,9 @@ struct [[nodiscard]] SFML_GRAPHICS_API RenderStates
     CoordinateType coordinateType{CoordinateType::Pixels}; //!< Texture coordinate type
     const Texture* texture{};                              //!< Texture
     const Shader*  shader{};                               //!< Shader
+
+    float distanceFieldOutlineThickness{};               //!< Outline thickness of the built-in distance field shader
+    Color distanceFieldOutlineColor{Color::Transparent}; //!< Outline color of the built-in distance field shader
 };
 
 } // namespace sf
@@ -130,6 +134,11 @@ struct [[nodiscard]] SFML_GRAPHICS_API RenderStates
 /// \li the texture: what image is mapped to the object
 /// \li the shader: what custom effect is applied to the object
 ///
+/// The distance field outline is only read by the built-in
+/// shader which sf::Text uses for distance field glyphs. Being
+/// part of the render states, it is applied per draw call, so
+/// that batched texts with different outlines do not interfere.
+///
 /// High-level objects such as sprites or text force some of
 /// these states when they are drawn. For example, a sprite
 /// will set its own texture, so that you don't have to care
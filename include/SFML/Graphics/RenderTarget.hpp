@@ -17,14 +17,17 @@
 #include "SFML/Base/InPlacePImpl.hpp"
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class GraphicsContext;
+class IndexBuffer;
 class Shader;
 class Shape;
 class Sprite;
+struct SpriteInstance;
 class Texture;
 class Transform;
 class VertexBuffer;
@@ -42,6 +45,19 @@ struct Vertex;
 class [[nodiscard]] SFML_GRAPHICS_API RenderTarget
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the work submitted to the GPU
+    ///
+    /// \see getDrawStatistics, resetDrawStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] DrawStatistics
+    {
+        std::size_t drawCalls{};             //!< Number of OpenGL draw calls issued
+        std::size_t uploadedBytes{};         //!< Number of vertex and index bytes uploaded to the GPU
+        std::size_t redundantCallsAvoided{}; //!< Number of OpenGL binds and uploads skipped because the state was already current
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -368,6 +384,113 @@ public:
         draw(vertices, N, type, states);
     }
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by an array of vertices
+    ///
+    /// The primitives are assembled by fetching the vertices in
+    /// the order given by \a indices, which allows vertices shared
+    /// by multiple primitives to be specified only once.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*       vertices,
+              std::size_t         vertexCount,
+              const unsigned int* indices,
+              std::size_t         indexCount,
+              PrimitiveType       type,
+              const RenderStates& states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by contiguous containers of vertices and indices
+    ///
+    /// \tparam ContiguousVertexRange Type of the contiguous vertex container,
+    ///         must support `.data()` and `.size()` operations.
+    /// \tparam ContiguousIndexRange Type of the contiguous index container,
+    ///         must support `.data()` and `.size()` operations.
+    ///
+    /// \param vertices Reference to the contiguous vertex container
+    /// \param indices  Reference to the contiguous index container
+    /// \param type     Type of primitives to draw
+    /// \param states   Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename ContiguousVertexRange, typename ContiguousIndexRange>
+    void draw(const ContiguousVertexRange& vertices,
+              const ContiguousIndexRange&  indices,
+              PrimitiveType                type,
+              const RenderStates&          states = getDefaultRenderStates())
+        requires(requires { draw(vertices.data(), vertices.size(), indices.data(), indices.size(), type, states); })
+    {
+        draw(vertices.data(), vertices.size(), indices.data(), indices.size(), type, states);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw quads defined by an array of vertices
+    ///
+    /// Each quad is made of 4 consecutive vertices, specified in
+    /// triangle strip order (e.g. top-left, bottom-left, top-right,
+    /// bottom-right). The quads are drawn as indexed triangles
+    /// using an index pattern shared by all the quad draw calls,
+    /// so only 4 vertices per quad are uploaded instead of 6.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array, must be a multiple of 4
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawQuads(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many textured quads with a single instanced draw call
+    ///
+    /// Only one compact `sf::SpriteInstance` record is uploaded
+    /// per quad, the quad itself is expanded on the GPU by the
+    /// built-in instanced shader. The transform of \a states is
+    /// applied on top of the transform of each instance.
+    ///
+    /// If \a states contains a shader, it must declare the same
+    /// per-instance attributes as the built-in instanced shader
+    /// (`sf_a_instanceTransformX`, `sf_a_instanceTransformY`,
+    /// `sf_a_instanceTextureRect` and `sf_a_instanceColor`).
+    /// The texture and coordinate type of \a states are ignored.
+    ///
+    /// \param texture       Texture shared by all the instances
+    /// \param instances     Pointer to the instances
+    /// \param instanceCount Number of instances in the array
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const Texture&        texture,
+                       const SpriteInstance* instances,
+                       std::size_t           instanceCount,
+                       const RenderStates&   states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many textured quads defined by a contiguous container of instances
+    ///
+    /// \tparam ContiguousInstanceRange Type of the contiguous container,
+    ///         must support `.data()` and `.size()` operations.
+    ///
+    /// \param texture   Texture shared by all the instances
+    /// \param instances Reference to the contiguous instance container
+    /// \param states    Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename ContiguousInstanceRange>
+    void drawInstanced(const Texture&                 texture,
+                       const ContiguousInstanceRange& instances,
+                       const RenderStates&            states = getDefaultRenderStates())
+        requires(requires { drawInstanced(texture, instances.data(), instances.size(), states); })
+    {
+        drawInstanced(texture, instances.data(), instances.size(), states);
+    }
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -391,6 +514,182 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = getDefaultRenderStates());
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer and an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by a vertex buffer and an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Index of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start accumulating draw calls into a batch
+    ///
+    /// While batching is enabled, draw calls made of triangles
+    /// (`Triangles`, `TriangleStrip` and `TriangleFan`) are not
+    /// submitted to the GPU immediately. Instead, their vertices
+    /// are pre-transformed on the CPU and appended to a single
+    /// indexed triangle list, which is only uploaded and drawn
+    /// when the texture, shader, blend mode, stencil mode or view
+    /// changes, or when the batch is flushed explicitly.
+    ///
+    /// All the resources referenced by batched draw calls
+    /// (textures, shaders) must stay alive until the batch is
+    /// flushed. Changes to the uniforms of a shader in between
+    /// two draw calls using that same shader are not detected:
+    /// call `flushBatch` before modifying them.
+    ///
+    /// \see endBatch, flushBatch, isBatching
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit all pending batched draw calls and stop batching
+    ///
+    /// \see beginBatch, flushBatch, isBatching
+    ///
+    ////////////////////////////////////////////////////////////
+    void endBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit all pending batched draw calls
+    ///
+    /// Batching stays enabled after this call. In deferred mode,
+    /// the recorded commands are sorted and submitted as well.
+    /// This function does nothing if there are no pending draw calls.
+    ///
+    /// \see beginBatch, endBatch, isBatching
+    ///
+    ////////////////////////////////////////////////////////////
+    void flushBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether draw-call batching is enabled
+    ///
+    /// \return True if draw calls are currently being batched
+    ///
+    /// \see beginBatch, endBatch, flushBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatching() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording draw calls into a deferred command queue
+    ///
+    /// Deferred mode extends batching: runs of compatible draw
+    /// calls are recorded as commands instead of being submitted
+    /// when the render states change. When the queue is flushed,
+    /// the commands are sorted by layer, shader and texture, and
+    /// consecutive commands sharing the same render states are
+    /// merged into a single draw call.
+    ///
+    /// Draw calls of different layers are always submitted in
+    /// increasing layer order. Within a layer, the submission order
+    /// is only preserved for draw calls using the same shader and
+    /// texture, so overlapping translucent geometry which relies
+    /// on the drawing order must be put in separate layers.
+    /// Changing the stencil mode is a sort barrier: within a layer,
+    /// the draw calls recorded after the change are submitted after
+    /// the ones recorded before it, so that stencil masks are drawn
+    /// before the geometry they clip.
+    ///
+    /// Draw calls which cannot be batched, view changes, `clear`
+    /// and `display` flush the queue before taking effect. The
+    /// queue is also flushed when its vertices would no longer
+    /// fit in the streaming buffer: the draw calls recorded
+    /// afterwards are only sorted among themselves. The same
+    /// resource lifetime rules as for `beginBatch` apply.
+    ///
+    /// \see endDeferred, setDeferredLayer, isDeferred, flushBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginDeferred();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit all recorded draw commands and stop deferring
+    ///
+    /// \see beginDeferred, flushBatch, isDeferred
+    ///
+    ////////////////////////////////////////////////////////////
+    void endDeferred();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layer of the draw calls recorded from now on
+    ///
+    /// The layer is the most significant part of the sort key of
+    /// deferred draw commands: commands of lower layers are
+    /// submitted first. The default layer is 0.
+    ///
+    /// \param layer Layer of the subsequent deferred draw calls
+    ///
+    /// \see getDeferredLayer, beginDeferred
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDeferredLayer(std::uint8_t layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the draw calls being recorded
+    ///
+    /// \return Current deferred layer
+    ///
+    /// \see setDeferredLayer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint8_t getDeferredLayer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether draw calls are recorded into the deferred command queue
+    ///
+    /// \return True if deferred mode is enabled
+    ///
+    /// \see beginDeferred, endDeferred
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDeferred() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the draw statistics accumulated since the last reset
+    ///
+    /// Calling `resetDrawStatistics` once per frame, right
+    /// before drawing starts, allows measuring the number of
+    /// draw calls and the vertex bandwidth of each frame.
+    ///
+    /// \return Draw statistics of the render target
+    ///
+    /// \see resetDrawStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const DrawStatistics& getDrawStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset all the draw statistics counters to zero
+    ///
+    /// \see getDrawStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetDrawStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -437,6 +736,9 @@ public:
     /// states needed by SFML are set, so that subsequent draw()
     /// calls will work as expected.
     ///
+    /// Pending batched or deferred draw calls are submitted first,
+    /// so that they are not mixed up with the direct OpenGL rendering.
+    ///
     /// Example:
     /// \code
     /// // OpenGL code here...
@@ -480,6 +782,15 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool clearImpl();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the internal OpenGL states, without submitting the pending batch
+    ///
+    /// Used by `setupDraw`, which can be reached while submitting
+    /// the pending batch.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetGLStatesImpl();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the default render states (used to avoid header dependency)
     ///
@@ -540,6 +851,35 @@ private:
     ////////////////////////////////////////////////////////////
     void setupDraw(bool useVertexCache, const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append pre-transformed vertices to the current batch
+    ///
+    /// The batch is flushed first (or recorded as a deferred
+    /// command, in deferred mode) if \a states are not compatible
+    /// with the render states of the pending batched draw calls.
+    /// The caller is responsible for appending the triangle indices.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param states      Render states to use for drawing
+    ///
+    /// \return Index of the first appended vertex in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int appendToBatch(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the pending run of batched draw calls as a deferred command
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordDeferredCommand();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort and submit the recorded deferred commands
+    ///
+    ////////////////////////////////////////////////////////////
+    void submitDeferredCommands();
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the primitives
     ///
@@ -550,6 +890,38 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives using the currently bound index buffer
+    ///
+    /// \param type        Type of primitives to draw
+    /// \param indexOffset Offset in bytes of the first index in the index buffer
+    /// \param indexCount  Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, std::size_t indexOffset, std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload vertices to the streaming vertex buffer
+    ///
+    /// \param vertices    Pointer to the vertex data
+    /// \param vertexCount Number of vertices to upload
+    ///
+    /// \return Index of the first uploaded vertex in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t streamVertices(const void* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload indices to the streaming index buffer and bind it
+    ///
+    /// \param indices    Pointer to the index data
+    /// \param indexCount Number of indices to upload
+    ///
+    /// \return Offset in bytes of the first uploaded index in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t streamIndices(const unsigned int* indices, std::size_t indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -562,7 +934,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 768> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
 };
 
 } // namespace sf
@@ -163,6 +163,14 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> waitEvent(Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Submits pending batched draws and forwards to `Window::display`
+    ///
+    /// \see Window::display, RenderTarget::flushBatch
+    ///
+    ////////////////////////////////////////////////////////////
+    void display();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Function called after the window has been resized
@@ -70,6 +70,26 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline constexpr CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform block binding point reserved for the built-in matrices
+    ///
+    /// Shaders declaring the following block are automatically
+    /// assigned to this binding point, and the render targets
+    /// update it with the matrices of each draw call:
+    /// \code
+    /// layout(std140) uniform sf_u_BuiltInMatrices
+    /// {
+    ///     mat4 sf_u_modelViewProjectionMatrix;
+    ///     mat4 sf_u_textureMatrix;
+    /// };
+    /// \endcode
+    ///
+    /// Shaders declaring the matrices as plain uniforms keep
+    /// working, but they are updated one program at a time.
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr unsigned int builtInUniformBlockBinding{0u};
+
     ////////////////////////////////////////////////////////////
     /// \brief Type-safe wrapper over a non-null shader uniform location
     ///
@@ -330,6 +350,27 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<UniformLocation> getUniformLocation(std::string_view uniformName) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Assign a uniform block of the shader to a binding point
+    ///
+    /// All the uniforms declared in the block take their values
+    /// from the `sf::UniformBuffer` bound to the same binding
+    /// point, which allows updating many uniforms, possibly
+    /// shared by multiple shaders, with a single upload.
+    ///
+    /// Binding point `builtInUniformBlockBinding` is reserved
+    /// for the built-in matrices and cannot be used.
+    ///
+    /// \param blockName    Name of the uniform block in GLSL
+    /// \param bindingPoint Index of the binding point
+    ///
+    /// \return True if the block was found in the shader
+    ///
+    /// \see sf::UniformBuffer::bind
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setUniformBlockBinding(std::string_view blockName, unsigned int bindingPoint) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
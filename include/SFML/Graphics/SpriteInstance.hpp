@@ -0,0 +1,66 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Transform.hpp"
+
+#include "SFML/System/Rect.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Compact description of a single textured quad,
+///        drawn with `sf::RenderTarget::drawInstanced`
+///
+/// By default, the instance has an identity transform, an
+/// empty texture rectangle and a white color.
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] SpriteInstance
+{
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Transform transform;           //!< Affine transform of the quad
+    FloatRect textureRect{};       //!< Texture rectangle in pixels, also defines the size of the quad
+    Color     color{Color::White}; //!< Global color of the quad
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \struct sf::SpriteInstance
+/// \ingroup graphics
+///
+/// A sprite instance is the per-quad record used by
+/// `sf::RenderTarget::drawInstanced`: it holds everything that
+/// usually differs between sprites sharing the same texture
+/// (transform, texture rectangle and color), and nothing else.
+///
+/// The quad is expanded on the GPU: its local corners span
+/// from (0, 0) to the absolute size of `textureRect`, which
+/// mimics the geometry of an `sf::Sprite`. A negative width
+/// or height flips the texture, as with `sf::Sprite`.
+///
+/// Example:
+/// \code
+/// std::vector<sf::SpriteInstance> particles(10'000);
+///
+/// for (sf::SpriteInstance& particle : particles)
+/// {
+///     particle.transform   = sf::Transform().translate(randomPosition()).rotate(randomAngle());
+///     particle.textureRect = {{0.f, 0.f}, {8.f, 8.f}};
+///     particle.color       = sf::Color::Yellow;
+/// }
+///
+/// window.drawInstanced(texture, particles);
+/// \endcode
+///
+/// \see sf::RenderTarget::drawInstanced, sf::Sprite
+///
+////////////////////////////////////////////////////////////
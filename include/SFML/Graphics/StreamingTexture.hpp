@@ -0,0 +1,241 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class GraphicsContext;
+
+////////////////////////////////////////////////////////////
+/// \brief Mipmapped texture whose levels are uploaded
+///        progressively, coarsest first
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API StreamingTexture
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingTexture(const StreamingTexture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingTexture& operator=(const StreamingTexture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingTexture(StreamingTexture&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingTexture& operator=(StreamingTexture&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a streaming texture from an image
+    ///
+    /// The mipmap levels are built on the CPU with
+    /// `Image::createDownsampled`. The levels that fit within
+    /// \a mipTailSize x \a mipTailSize pixels (the "mip tail")
+    /// are uploaded right away, so that the texture can be drawn
+    /// immediately, at a low resolution. The other levels are
+    /// uploaded by `stream`.
+    ///
+    /// \param image       Image to stream to the texture
+    /// \param sRgb        True to enable sRGB conversion, false to disable it
+    /// \param mipTailSize Maximum width and height of the levels uploaded right away
+    ///
+    /// \return Streaming texture if creation was successful, otherwise `base::nullOpt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<StreamingTexture> create(GraphicsContext& graphicsContext,
+                                                                 const Image&     image,
+                                                                 bool             sRgb        = false,
+                                                                 unsigned int     mipTailSize = 64u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the pending levels, within a byte budget
+    ///
+    /// Call this function once per frame. Levels are uploaded
+    /// from the coarsest to the finest, a band of rows at a
+    /// time, and a level is only sampled once it is complete.
+    /// At least one row is uploaded if any is pending, so that
+    /// streaming always makes progress.
+    ///
+    /// Levels finer than the target level are not uploaded.
+    ///
+    /// \param byteBudget Maximum number of bytes to upload
+    ///
+    /// \return Number of bytes uploaded
+    ///
+    /// \see setTargetLevel, getPendingBytes
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t stream(std::size_t byteBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the finest level to stream
+    ///
+    /// Level 0 is the full resolution image (the default), each
+    /// following level is half the size of the previous one.
+    /// Raising the target level (e.g. for a texture that is only
+    /// seen from afar) pauses streaming before the finest levels,
+    /// lowering it again resumes it. Levels that are already
+    /// uploaded stay in graphics memory.
+    ///
+    /// \param level Index of the finest level to stream
+    ///
+    /// \see getTargetLevel, stream
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTargetLevel(unsigned int level);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the finest level to stream
+    ///
+    /// \return Index of the finest level to stream
+    ///
+    /// \see setTargetLevel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getTargetLevel() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the finest level that has been fully uploaded
+    ///
+    /// This is the level sampled when the texture is magnified.
+    ///
+    /// \return Index of the finest resident level
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getResidentLevel() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of mipmap levels of the texture
+    ///
+    /// \return Number of levels, including the full resolution one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLevelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes left to upload to reach the target level
+    ///
+    /// \return Number of bytes left to upload
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingBytes() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see Texture::setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture to draw
+    ///
+    /// Its size is the size of the full resolution image,
+    /// whatever the resident level.
+    ///
+    /// \return Streamed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Directly initialize data members
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] StreamingTexture(base::PassKey<StreamingTexture>&&,
+                                   Texture&&                            texture,
+                                   std::vector<base::Optional<Image>>&& levels);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a band of rows of the level being streamed
+    ///
+    /// \return Number of bytes uploaded
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t uploadRows(unsigned int rowCount);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Texture                            m_texture;        //!< Texture sampled when drawing
+    std::vector<base::Optional<Image>> m_levels;         //!< CPU copies of the levels left to upload
+    unsigned int                       m_residentLevel;  //!< Finest fully uploaded level
+    unsigned int                       m_targetLevel{};  //!< Finest level to stream
+    unsigned int                       m_uploadedRows{}; //!< Rows of the next finer level already uploaded
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::StreamingTexture
+/// \ingroup graphics
+///
+/// sf::StreamingTexture is meant for large images, such as
+/// backgrounds and world maps, that don't need to be drawn
+/// at full resolution as soon as they are loaded.
+///
+/// Instead of uploading the whole image and generating the
+/// mipmap on the GPU, the mipmap levels are built on the CPU
+/// and uploaded from the smallest to the largest one, under
+/// a per-frame byte budget. The texture can be drawn from the
+/// start: it simply gets sharper as finer levels arrive. If
+/// the player never zooms in, the finest levels can be left
+/// out entirely with `setTargetLevel`.
+///
+/// The CPU copy of each level is released once it has been
+/// uploaded.
+///
+/// Example:
+/// \code
+/// auto background = sf::StreamingTexture::create(graphicsContext, image).value();
+/// const sf::Sprite sprite(background.getTexture().getRect());
+///
+/// while (window.isOpen())
+/// {
+///     // Upload at most 1MB per frame
+///     background.stream(1024u * 1024u);
+///
+///     window.clear();
+///     window.draw(sprite, background.getTexture());
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::Image
+///
+////////////////////////////////////////////////////////////
@@ -47,6 +47,30 @@ public:
         StrikeThrough = 1 << 3  //!< Strike through characters
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enumeration of the horizontal alignments of the lines
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] Alignment
+    {
+        Left,   //!< Lines start at the left of the text
+        Center, //!< Lines are centered
+        Right   //!< Lines end at the right of the text
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Metrics of a line of the laid out text
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] LineMetrics
+    {
+        std::size_t firstCharacter{}; //!< Index of the first character of the line
+        std::size_t characterCount{}; //!< Number of characters of the line, including the line break
+        Vector2f    position;         //!< Top-left corner of the line, in local coordinates
+        float       width{};          //!< Width of the line, without the space where it was wrapped
+        float       height{};         //!< Height of the line (line spacing)
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the text from a string, font and size
     ///
@@ -116,6 +140,11 @@ public:
     /// \endcode
     /// A text's string is empty by default.
     ///
+    /// When the new string only appends characters to the current
+    /// one (e.g. a log or a typewriter effect), only the appended
+    /// characters are laid out, unless the text is underlined,
+    /// struck through, wrapped or not aligned to the left.
+    ///
     /// \param string New string
     ///
     /// \see getString
@@ -247,6 +276,11 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// If the font uses distance field glyphs, the outline is
+    /// limited to the spread of the distance field (see
+    /// `sf::Font::getDistanceFieldSpread`), and it is not drawn
+    /// when the text is drawn with a custom shader.
+    ///
     /// \param thickness New outline thickness, in pixels
     ///
     /// \see getOutlineThickness
@@ -254,6 +288,37 @@ public:
     ////////////////////////////////////////////////////////////
     void setOutlineThickness(float thickness);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the horizontal alignment of the lines
+    ///
+    /// Lines are aligned within the maximum width if there is
+    /// one (see `setMaxWidth`), within the widest line otherwise.
+    /// The default alignment is sf::Text::Alignment::Left.
+    ///
+    /// \param alignment New alignment
+    ///
+    /// \see getAlignment
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlignment(Alignment alignment);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum width of the lines
+    ///
+    /// Lines longer than \a maxWidth are wrapped at their last
+    /// space or tabulation, or before the first character that
+    /// doesn't fit if a single word is too long. Words are
+    /// measured with the cached advances and kerning of the
+    /// font, in the same pass that lays out the characters.
+    /// A maximum width of 0 (the default) disables wrapping.
+    ///
+    /// \param maxWidth New maximum width, in local coordinates
+    ///
+    /// \see getMaxWidth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxWidth(float maxWidth);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's string
     ///
@@ -356,6 +421,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] float getOutlineThickness() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the horizontal alignment of the lines
+    ///
+    /// \return Alignment of the lines
+    ///
+    /// \see setAlignment
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Alignment getAlignment() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum width of the lines
+    ///
+    /// \return Maximum width of the lines, 0 if wrapping is disabled
+    ///
+    /// \see setMaxWidth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getMaxWidth() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the position of the \a index-th character
     ///
@@ -366,6 +451,10 @@ public:
     /// If \a index is out of range, the position of the end of
     /// the string is returned.
     ///
+    /// The positions of all the characters are computed along
+    /// with the geometry of the text, so this function runs in
+    /// constant time as long as the text is not modified.
+    ///
     /// \param index Index of the character
     ///
     /// \return Position of the character
@@ -373,6 +462,52 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Vector2f findCharacterPos(std::size_t index) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the character under a point
+    ///
+    /// This function is the opposite of `findCharacterPos`: it
+    /// returns the index of the character boundary closest to
+    /// \a point, on the line under it. This is where a cursor
+    /// would be inserted when clicking at \a point. Points above
+    /// or below the text hit the first or last line.
+    ///
+    /// \param point Point in global coordinates
+    ///
+    /// \return Index of the character, the size of the string for the end of the text
+    ///
+    /// \see findCharacterPos
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findCharacterIndex(Vector2f point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of lines of the laid out text
+    ///
+    /// Includes the lines created by wrapping. An empty text
+    /// has a single, empty, line.
+    ///
+    /// \return Number of lines
+    ///
+    /// \see getLineMetrics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLineCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the metrics of a line of the laid out text
+    ///
+    /// The layout is cached with the geometry, it is only
+    /// computed again when the text is modified.
+    ///
+    /// \param index Index of the line, must be lower than `getLineCount()`
+    ///
+    /// \return Metrics of the line
+    ///
+    /// \see getLineCount
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const LineMetrics& getLineMetrics(std::size_t index) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the local bounding rectangle of the entity
     ///
@@ -411,7 +546,7 @@ public:
     void draw(RenderTarget& target, RenderStates states) const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Non-owning view over the vertices of the text
     ///
     ////////////////////////////////////////////////////////////
     struct VertexSpan
@@ -420,6 +555,16 @@ public:
         std::size_t   size;
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the vertices of the text, in local coordinates
+    ///
+    /// The geometry is made of quads of 4 vertices each, in
+    /// triangle strip order: outline quads come first, followed
+    /// by fill quads. They can be drawn with `RenderTarget::drawQuads`.
+    ///
+    /// \return View over the vertices, valid until the text is modified
+    ///
+    ////////////////////////////////////////////////////////////
     [[nodiscard]] VertexSpan getVertices() const;
 
 private:
@@ -436,7 +581,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 192> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 256> m_impl; //!< Implementation details
 
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
@@ -466,6 +611,12 @@ SFML_BASE_DEFINE_ENUM_CLASS_BITWISE_OPS(Text::Style);
 /// graphical size of the text, or to get the global position
 /// of a given character.
 ///
+/// Lines can be wrapped at a maximum width and aligned to the
+/// left, center or right. The resulting layout (line metrics,
+/// character positions) is cached along with the geometry and
+/// can be queried with `getLineMetrics`, or hit-tested with
+/// `findCharacterIndex`, e.g. to place a cursor.
+///
 /// sf::Text works in combination with the sf::Font class, which
 /// loads and provides the glyphs (visual characters) of a given font.
 ///
@@ -14,11 +14,18 @@
 
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
+#include "SFML/Base/UniquePtr.hpp"
 
 #include <cstddef>
 #include <cstdint>
 
 
+namespace sf::priv
+{
+struct CompressedImage;
+struct TextureUploadRing;
+} // namespace sf::priv
+
 namespace sf
 {
 class GraphicsContext;
@@ -27,6 +34,7 @@ class InputStream;
 class Path;
 class Shape;
 class Sprite;
+class TextureReadback;
 class Window;
 
 ////////////////////////////////////////////////////////////
@@ -36,6 +44,17 @@ class Window;
 class SFML_GRAPHICS_API Texture
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle to an asynchronous update of the texture
+    ///
+    /// \see updateAsync, isUploadComplete, waitForUpload
+    ///
+    ////////////////////////////////////////////////////////////
+    struct UploadTicket
+    {
+        std::uint64_t sequence{}; //!< Sequence number of the upload within the texture (zero is "no upload")
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -79,6 +98,32 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Texture> create(GraphicsContext& graphicsContext, Vector2u size, bool sRgb = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a single-channel texture
+    ///
+    /// The texture stores a single 8-bit value per pixel, using a
+    /// quarter of the graphics memory of a regular texture. It is
+    /// sampled as a white pixel whose alpha is the stored value,
+    /// which is how coverage masks such as font glyphs are drawn.
+    ///
+    /// The pixel arrays passed to the `update` functions of a
+    /// single-channel texture contain one byte per pixel.
+    ///
+    /// WebGL cannot swizzle texture channels, so on Emscripten
+    /// the texture is stored as RGBA and the values are expanded
+    /// on upload: it samples the same, without the memory savings.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param size Width and height of the texture
+    ///
+    /// \return Texture if creation was successful, otherwise `base::nullOpt`
+    ///
+    /// \see isSingleChannel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Texture> createSingleChannel(GraphicsContext& graphicsContext, Vector2u size);
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the texture from a file on disk
     ///
@@ -91,6 +136,14 @@ public:
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the getMaximumSize function.
     ///
+    /// KTX2 and DDS files holding pre-compressed pixels (BC1,
+    /// BC2, BC3, ETC2 RGB8 and ETC2 RGBA8 formats) are uploaded
+    /// as is, along with their mipmap levels, when the graphics
+    /// driver supports their format and the whole image is
+    /// loaded. Otherwise, the largest level is decompressed on
+    /// the CPU. A texture holding compressed pixels cannot be
+    /// updated, copied, read back nor have its mipmap generated.
+    ///
     /// If this function fails, the texture is left unchanged.
     ///
     /// \param filename Path of the image file to load
@@ -120,6 +173,14 @@ public:
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the getMaximumSize function.
     ///
+    /// KTX2 and DDS files holding pre-compressed pixels (BC1,
+    /// BC2, BC3, ETC2 RGB8 and ETC2 RGBA8 formats) are uploaded
+    /// as is, along with their mipmap levels, when the graphics
+    /// driver supports their format and the whole image is
+    /// loaded. Otherwise, the largest level is decompressed on
+    /// the CPU. A texture holding compressed pixels cannot be
+    /// updated, copied, read back nor have its mipmap generated.
+    ///
     /// If this function fails, the texture is left unchanged.
     ///
     /// \param data Pointer to the file data in memory
@@ -151,6 +212,14 @@ public:
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the getMaximumSize function.
     ///
+    /// KTX2 and DDS files holding pre-compressed pixels (BC1,
+    /// BC2, BC3, ETC2 RGB8 and ETC2 RGBA8 formats) are uploaded
+    /// as is, along with their mipmap levels, when the graphics
+    /// driver supports their format and the whole image is
+    /// loaded. Otherwise, the largest level is decompressed on
+    /// the CPU. A texture holding compressed pixels cannot be
+    /// updated, copied, read back nor have its mipmap generated.
+    ///
     /// If this function fails, the texture is left unchanged.
     ///
     /// \param stream Source stream to read from
@@ -213,6 +282,9 @@ public:
     /// them to a new image, potentially applying transformations
     /// to pixels if necessary (texture may be padded or flipped).
     ///
+    /// Single-channel textures are copied the way they are sampled,
+    /// as white pixels whose alpha is the stored value.
+    ///
     /// \return Image containing the texture's pixels
     ///
     /// \see loadFromImage
@@ -220,11 +292,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Image copyToImage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the texture pixels to an image, without waiting for the GPU
+    ///
+    /// The copy is queued on the GPU, and the returned object
+    /// hands back the image once the GPU is done, usually a
+    /// frame or two later. This avoids the pipeline stall of
+    /// `copyToImage`, e.g. when capturing frames from a render
+    /// texture (call `display` on it first).
+    ///
+    /// Later changes to the texture do not affect the pixels
+    /// being read back.
+    ///
+    /// \return Pending copy of the texture's pixels
+    ///
+    /// \see copyToImage, TextureReadback
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureReadback copyToImageAsync() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole texture from an array of pixels
     ///
     /// The \a pixel array is assumed to have the same size as
-    /// the \a area rectangle, and to contain 32-bits RGBA pixels.
+    /// the \a area rectangle, and to contain 32-bits RGBA pixels
+    /// (8-bits values if the texture is single-channel).
     ///
     /// No additional check is performed on the size of the pixel
     /// array. Passing invalid arguments will lead to an undefined
@@ -242,7 +334,8 @@ public:
     /// \brief Update a part of the texture from an array of pixels
     ///
     /// The size of the \a pixel array must match the \a width and
-    /// \a height arguments, and it must contain 32-bits RGBA pixels.
+    /// \a height arguments, and it must contain 32-bits RGBA pixels
+    /// (8-bits values if the texture is single-channel).
     ///
     /// No additional check is performed on the size of the pixel
     /// array or the bounds of the area to update. Passing invalid
@@ -258,6 +351,91 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole texture from an array of pixels, asynchronously
+    ///
+    /// Same as `updateAsync(pixels, getSize(), {0, 0})`.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    ///
+    /// \return Ticket that can be used to query the completion of the upload
+    ///
+    /// \see update, updateAsync
+    ///
+    ////////////////////////////////////////////////////////////
+    UploadTicket updateAsync(const std::uint8_t* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of pixels, asynchronously
+    ///
+    /// The pixels are copied to a pixel buffer object taken from
+    /// a small ring owned by the texture, then transferred to the
+    /// texture by the GPU while the CPU keeps running. The \a pixels
+    /// array can be reused as soon as this function returns.
+    ///
+    /// Unlike `update`, this function does not flush the OpenGL
+    /// command queue: drawing the texture from the same context
+    /// always sees the new pixels, but other contexts only do
+    /// after a call to `flushUploads` or `waitForUpload`.
+    ///
+    /// This function only blocks when all the buffers of the ring
+    /// are still in use by the GPU, which happens when updating
+    /// the texture more often than the GPU can keep up with.
+    ///
+    /// The same requirements as for `update` apply to the
+    /// arguments.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in \a pixels
+    /// \param dest   Coordinates of the destination position
+    ///
+    /// \return Ticket that can be used to query the completion of the upload
+    ///
+    /// \see update, isUploadComplete, waitForUpload, flushUploads
+    ///
+    ////////////////////////////////////////////////////////////
+    UploadTicket updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an asynchronous update has been completed by the GPU
+    ///
+    /// This function never blocks.
+    ///
+    /// \param ticket Ticket returned by `updateAsync` on this texture
+    ///
+    /// \return True if the GPU is done with the upload, false if it is still in flight
+    ///
+    /// \see updateAsync, waitForUpload
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isUploadComplete(UploadTicket ticket) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until an asynchronous update has been completed by the GPU
+    ///
+    /// Once this function returns, the new pixels are visible
+    /// in all the contexts sharing this texture.
+    ///
+    /// \param ticket Ticket returned by `updateAsync` on this texture
+    ///
+    /// \see updateAsync, isUploadComplete
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForUpload(UploadTicket ticket) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the pending asynchronous updates visible to other contexts
+    ///
+    /// Flushes the OpenGL command queue if asynchronous updates
+    /// were issued since the last flush, without waiting for
+    /// them. This is only needed when the texture is drawn from
+    /// another context (e.g. another thread).
+    ///
+    /// \see updateAsync
+    ///
+    ////////////////////////////////////////////////////////////
+    void flushUploads();
+
     ////////////////////////////////////////////////////////////
     /// \brief Update a part of this texture from another texture
     ///
@@ -308,6 +486,8 @@ public:
     /// Passing an image bigger than the texture will lead to an
     /// undefined behavior.
     ///
+    /// Single-channel textures receive the alpha channel of the image.
+    ///
     /// This function does nothing if the texture was not
     /// previously created.
     ///
@@ -323,6 +503,8 @@ public:
     /// Passing an invalid combination of image size and destination
     /// will lead to an undefined behavior.
     ///
+    /// Single-channel textures receive the alpha channel of the image.
+    ///
     /// This function does nothing if the texture was not
     /// previously created.
     ///
@@ -405,6 +587,16 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSrgb() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the texture stores a single channel per pixel
+    ///
+    /// \return True if the texture was created with `createSingleChannel`, false if not
+    ///
+    /// \see createSingleChannel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSingleChannel() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable repeating
     ///
@@ -549,6 +741,7 @@ private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class StreamingTexture;
 
     ////////////////////////////////////////////////////////////
     /// \brief Compute and return the texture matrix (used by shaders)
@@ -570,9 +763,28 @@ public:
                           Vector2u         size,
                           Vector2u         actualSize,
                           unsigned int     texture,
-                          bool             sRgb);
+                          bool             sRgb,
+                          bool             singleChannel);
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a texture with the given pixel format
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Texture> createImpl(GraphicsContext& graphicsContext,
+                                                            Vector2u         size,
+                                                            bool             sRgb,
+                                                            bool             singleChannel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from pre-compressed pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Texture> loadFromCompressedImage(GraphicsContext&             graphicsContext,
+                                                                         const priv::CompressedImage& compressedImage,
+                                                                         bool                         sRgb,
+                                                                         const IntRect&               area);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
     ///
@@ -606,12 +818,16 @@ private:
     unsigned int     m_texture{};       //!< Internal texture identifier
     bool             m_isSmooth{};      //!< Status of the smooth filter
     bool             m_sRgb{};          //!< Should the texture source be converted from sRGB?
+    bool             m_singleChannel{}; //!< Does the texture store a single 8-bit channel per pixel?
+    bool             m_compressed{};    //!< Does the texture store pre-compressed pixels?
     bool             m_isRepeated{};    //!< Is the texture in repeat mode?
     mutable bool     m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
     bool             m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
     bool             m_hasMipmap{};     //!< Has the mipmap been generated?
     std::uint64_t    m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
 
+    base::UniquePtr<priv::TextureUploadRing> m_uploadRing; //!< Pixel buffers of the asynchronous updates, if any
+
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
     ////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class Image;
+class Texture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Set of textures holding many small images, packed
+///        at runtime to allow batching their draw calls
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of an image added to the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Entry
+    {
+        std::size_t pageIndex{}; //!< Index of the page texture holding the pixels, see `getTexture`
+        IntRect     textureRect; //!< Area of the pixels within the page texture, usable with `sf::Sprite::setTextureRect`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty atlas
+    ///
+    /// Pages start at \a initialPageSize and double in size when
+    /// they are full, up to the maximum texture size. Once a page
+    /// cannot grow anymore, a new page is created.
+    ///
+    /// \param initialPageSize Size of a newly created page texture
+    /// \param padding         Transparent gap between two images, in pixels
+    /// \param extrusion       Number of times the border pixels of each image are repeated
+    ///                        around it, which prevents bleeding when the textures are smoothed
+    ///
+    /// \return Texture atlas on success, `base::nullOpt` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<TextureAtlas> create(GraphicsContext& graphicsContext,
+                                                             Vector2u         initialPageSize = {256u, 256u},
+                                                             unsigned int     padding         = 1u,
+                                                             unsigned int     extrusion       = 1u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// \param image Image to copy to the atlas
+    ///
+    /// \return Location of the image, or `base::nullOpt` if it could not be added
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Entry> add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an array of pixels to the atlas
+    ///
+    /// The \a pixel array is assumed to contain 32-bits RGBA
+    /// pixels, and have the given \a size.
+    ///
+    /// \param pixels Array of pixels to copy to the atlas
+    /// \param size   Width and height of the pixel region contained in \a pixels
+    ///
+    /// \return Location of the pixels, or `base::nullOpt` if they could not be added
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Entry> add(const std::uint8_t* pixels, Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture of a page
+    ///
+    /// The returned reference stays valid for the whole lifetime
+    /// of the atlas, even when pages grow or are added.
+    ///
+    /// \param pageIndex Index of the page, as returned in `Entry::pageIndex`
+    ///
+    /// \return Texture of the page
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(std::size_t pageIndex = 0u) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pages
+    ///
+    /// \return Number of page textures in the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter of the pages
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see isSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter of the pages is enabled
+    ///
+    /// \return True if smoothing is enabled, false if it is disabled
+    ///
+    /// \see setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Create an atlas from its settings
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextureAtlas(base::PassKey<TextureAtlas>&&,
+                                        GraphicsContext& graphicsContext,
+                                        Vector2u         initialPageSize,
+                                        unsigned int     padding,
+                                        unsigned int     extrusion);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 128> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// Drawing many sprites that all use a different texture
+/// forces a texture switch, and therefore a separate draw call,
+/// for each one of them. sf::TextureAtlas copies small images
+/// into a few large textures ("pages"), so that sprites using
+/// images of the same page can be batched together.
+///
+/// Images can be added at any time: each page is packed with
+/// sf::RectPacker, grows like the pages of sf::Font when it is
+/// full, and new pages are only created when the existing ones
+/// reached the maximum texture size.
+///
+/// Example:
+/// \code
+/// auto atlas = sf::TextureAtlas::create(graphicsContext).value();
+///
+/// const auto coin  = atlas.add(sf::Image::loadFromFile("coin.png").value()).value();
+/// const auto heart = atlas.add(sf::Image::loadFromFile("heart.png").value()).value();
+///
+/// sf::Sprite sprite(coin.textureRect);
+/// window.draw(sprite, atlas.getTexture(coin.pageIndex));
+///
+/// sprite.setTextureRect(heart.textureRect);
+/// window.draw(sprite, atlas.getTexture(heart.pageIndex));
+/// \endcode
+///
+/// \see sf::RectPacker, sf::Texture, sf::Sprite
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,243 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/FixedFunction.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+#include <cstddef>
+
+
+namespace sf
+{
+class GraphicsContext;
+class Path;
+
+////////////////////////////////////////////////////////////
+/// \brief Loads batches of textures, decoding the image files
+///        on worker threads
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief State of a texture requested with `enqueue`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] Status : unsigned char
+    {
+        Pending, //!< The texture is being decoded or waits to be uploaded
+        Loaded,  //!< The texture is uploaded and can be taken
+        Failed,  //!< The file could not be read, decoded or uploaded
+        Taken    //!< The texture was taken with `takeTexture`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called after each processed texture,
+    ///        with the numbers of processed and requested textures
+    ///
+    ////////////////////////////////////////////////////////////
+    using ProgressCallback = base::FixedFunction<void(std::size_t processedCount, std::size_t totalCount), 64>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called once all the requested textures are processed,
+    ///        with the number of textures that failed to load
+    ///
+    ////////////////////////////////////////////////////////////
+    using CompletionCallback = base::FixedFunction<void(std::size_t failedCount), 64>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the loader and start its worker threads
+    ///
+    /// \param threadCount Number of worker threads, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextureLoader(GraphicsContext& graphicsContext, unsigned int threadCount = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The files not decoded yet are skipped, and the worker
+    /// threads are joined.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureLoader(const TextureLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureLoader(TextureLoader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureLoader& operator=(TextureLoader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Request a texture to be loaded from a file on disk
+    ///
+    /// The file is read and decoded by a worker thread, the
+    /// texture is then created by `update`. Any format accepted
+    /// by `Texture::loadFromFile` is supported: pre-compressed
+    /// KTX2 and DDS files are only read by the worker threads.
+    ///
+    /// \param filename Path of the image file to load
+    /// \param sRgb     True to enable sRGB conversion, false to disable it
+    ///
+    /// \return Index of the texture, to pass to `getStatus` and `takeTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t enqueue(const Path& filename, bool sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the textures of the decoded images, within a time budget
+    ///
+    /// Call this function once per frame, from the thread
+    /// owning the graphics context. At least one decoded image
+    /// is uploaded per call, if any, so that loading always
+    /// makes progress. The callbacks are called from this
+    /// function.
+    ///
+    /// \param timeBudget Time after which no more textures are created
+    ///
+    /// \return Number of textures processed, including failures
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t update(Time timeBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state of a requested texture
+    ///
+    /// \param index Index returned by `enqueue`
+    ///
+    /// \return State of the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status getStatus(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take ownership of a loaded texture
+    ///
+    /// \param index Index returned by `enqueue`
+    ///
+    /// \return Texture if its status is `Status::Loaded`, otherwise `base::nullOpt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Texture> takeTexture(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of textures processed so far, including failures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getProcessedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of textures requested with `enqueue`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTotalCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether all the requested textures are processed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isFinished() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function called after each processed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProgressCallback(ProgressCallback callback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function called once all the requested textures are processed
+    ///
+    /// It is called again if more textures are requested
+    /// afterwards, once they are processed too.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCompletionCallback(CompletionCallback callback);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details, shared with the worker threads
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureLoader
+/// \ingroup graphics
+///
+/// sf::TextureLoader is meant for loading screens and level
+/// transitions, where many textures must be loaded at once.
+///
+/// `Texture::loadFromFile` reads and decodes the image file
+/// on the calling thread before uploading it, one texture
+/// after the other. sf::TextureLoader reads and decodes the
+/// files on a pool of worker threads instead, using all the
+/// cores of the CPU, while the thread owning the graphics
+/// context only uploads the decoded images, under a time
+/// budget per frame, so that the loading screen stays
+/// responsive.
+///
+/// The number of decoded images waiting to be uploaded is
+/// bounded, the worker threads pause when they get too far
+/// ahead of the uploads.
+///
+/// Example:
+/// \code
+/// sf::TextureLoader loader(graphicsContext);
+///
+/// std::vector<std::size_t> indices;
+/// for (const std::string& filename : levelTextureFilenames)
+///     indices.push_back(loader.enqueue(filename));
+///
+/// loader.setProgressCallback([&](std::size_t processed, std::size_t total)
+///                            { progressBar.setProgress(static_cast<float>(processed) / static_cast<float>(total)); });
+///
+/// while (!loader.isFinished())
+/// {
+///     loader.update(sf::milliseconds(8));
+///
+///     window.clear();
+///     window.draw(progressBar);
+///     window.display();
+/// }
+///
+/// for (const std::size_t index : indices)
+///     if (sf::base::Optional texture = loader.takeTexture(index))
+///         textures.push_back(SFML_BASE_MOVE(*texture));
+/// \endcode
+///
+/// \see sf::Texture, sf::Image
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,178 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Image.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+
+namespace sf
+{
+class GraphicsContext;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Pending copy of the pixels of a texture to an image
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReadback
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Discards the pixels if they haven't been taken.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(TextureReadback&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(TextureReadback&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels can be taken without blocking
+    ///
+    /// This function never blocks.
+    ///
+    /// \return True if the GPU is done copying the pixels, or if they were already taken
+    ///
+    /// \see takeImage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the pixels of the texture as an image
+    ///
+    /// Waits for the GPU to finish the copy if needed, so call
+    /// `isReady` first to avoid stalling. The pixels can only be
+    /// taken once.
+    ///
+    /// \return Image containing the texture's pixels, or `base::nullOpt` if they were already taken
+    ///
+    /// \see isReady
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Image> takeImage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the image being read back
+    ///
+    /// \return Size of the texture at the time of the readback, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Directly initialize data members
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureReadback(base::PassKey<Texture>&&,
+                                  GraphicsContext& graphicsContext,
+                                  unsigned int     buffer,
+                                  void*            fence,
+                                  Vector2u         size,
+                                  bool             flipped,
+                                  bool             singleChannel);
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Wrap pixels that were read synchronously
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureReadback(base::PassKey<Texture>&&, GraphicsContext& graphicsContext, Image&& image);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the buffer and the fence, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void release();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext*      m_graphicsContext; //!< The window context
+    unsigned int          m_buffer{};        //!< Pixel pack buffer receiving the pixels
+    void*                 m_fence{};         //!< Signaled once the pixels are in the buffer (`GLsync`)
+    Vector2u              m_size;            //!< Size of the image being read back
+    bool                  m_flipped{};       //!< Are the rows of the texture stored bottom to top?
+    bool                  m_singleChannel{}; //!< Does the texture store a single 8-bit channel per pixel?
+    base::Optional<Image> m_image;           //!< Pixels read synchronously, where buffers cannot be mapped
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReadback
+/// \ingroup graphics
+///
+/// sf::TextureReadback is returned by `sf::Texture::copyToImageAsync`.
+/// Unlike `sf::Texture::copyToImage`, which waits for the GPU
+/// to finish all its pending work before reading the pixels,
+/// the copy is queued in a pixel buffer object and the pixels
+/// are taken later, typically a frame or two after the request.
+///
+/// Only the visible area of the texture is read, and the
+/// rows are flipped while copying from the buffer to the
+/// final image if needed, so no intermediate copy of the
+/// pixels is made.
+///
+/// On WebGL, where buffers cannot be mapped, the pixels are
+/// read immediately and `isReady` always returns true.
+///
+/// Example:
+/// \code
+/// base::Optional<sf::TextureReadback> pendingCapture;
+///
+/// while (window.isOpen())
+/// {
+///     // ... draw the scene to `renderTexture`, then display it
+///
+///     if (pendingCapture.hasValue() && pendingCapture->isReady())
+///     {
+///         thumbnails.push_back(pendingCapture->takeImage().value());
+///         pendingCapture.reset();
+///     }
+///
+///     if (!pendingCapture.hasValue() && captureRequested)
+///         pendingCapture.emplace(renderTexture.getTexture().copyToImageAsync());
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::Image
+///
+////////////////////////////////////////////////////////////
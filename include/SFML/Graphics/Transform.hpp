@@ -44,21 +44,24 @@ public:
     [[nodiscard]] constexpr Transform(float a00, float a01, float a02, float a10, float a11, float a12);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Return the transform as a 4x4 matrix
+    /// \brief Expand the transform to a 4x4 matrix
     ///
-    /// This function returns a pointer to an array of 16 floats
-    /// containing the transform elements as a 4x4 matrix, which
-    /// is directly compatible with OpenGL functions.
+    /// The transform is stored as a compact 3x2 affine matrix.
+    /// This function writes its elements as a column-major 4x4
+    /// matrix into an array of 16 floats, which is directly
+    /// compatible with OpenGL functions.
     ///
     /// \code
     /// sf::Transform transform = ...;
-    /// glLoadMatrixf(transform.getMatrix());
+    /// float matrix[16];
+    /// transform.getMatrix(matrix);
+    /// glLoadMatrixf(matrix);
     /// \endcode
     ///
-    /// \return Pointer to a 4x4 matrix
+    /// \param target Pointer to an array of 16 floats to fill
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] constexpr const float* getMatrix() const;
+    constexpr void getMatrix(float* target) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the inverse of the transform
@@ -237,16 +240,19 @@ public:
     static const Transform Identity; //!< The identity transform (does nothing)
 
 private:
+    friend constexpr Transform operator*(const Transform& left, const Transform& right);
+    friend constexpr bool      operator==(const Transform& left, const Transform& right);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    // clang-format off
-    // Using a C-style array here to minimize compilation impact of `Transform.hpp`.
-    float m_matrix[16]{1.f, 0.f, 0.f, 0.f,
-                       0.f, 1.f, 0.f, 0.f,
-                       0.f, 0.f, 1.f, 0.f,
-                       0.f, 0.f, 0.f, 1.f}; //!< 4x4 matrix defining the transformation
-    // clang-format off
+    // Only the top two rows of the 3x3 matrix are stored, the bottom row is always (0, 0, 1)
+    float m_a00{1.f}; //!< Element (0, 0) of the matrix
+    float m_a01{0.f}; //!< Element (0, 1) of the matrix
+    float m_a02{0.f}; //!< Element (0, 2) of the matrix
+    float m_a10{0.f}; //!< Element (1, 0) of the matrix
+    float m_a11{1.f}; //!< Element (1, 1) of the matrix
+    float m_a12{0.f}; //!< Element (1, 2) of the matrix
 };
 
 ////////////////////////////////////////////////////////////
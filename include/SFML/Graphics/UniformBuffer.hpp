@@ -0,0 +1,196 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include <cstddef>
+
+
+namespace sf
+{
+class GraphicsContext;
+
+////////////////////////////////////////////////////////////
+/// \brief Buffer in graphics memory holding the values of
+///        a shader uniform block
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit UniformBuffer(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates \p byteCount
+    /// bytes of graphics memory. Any previously allocated memory
+    /// is freed in the process.
+    ///
+    /// \param byteCount Size of the uniform block, in bytes
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t byteCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer
+    ///
+    /// The whole range is uploaded with a single call, and must
+    /// fit in the created buffer.
+    ///
+    /// \param data      Pointer to the data to copy to the buffer
+    /// \param byteCount Number of bytes to copy
+    /// \param offset    Offset in the buffer to copy to, in bytes
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t byteCount, std::size_t offset = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the buffer from a struct mirroring the uniform block
+    ///
+    /// The members of \p block must follow the `std140` layout
+    /// of the block declared in GLSL.
+    ///
+    /// \param block Values of the uniform block
+    ///
+    /// \return True if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard]] bool update(const T& block)
+    {
+        return update(&block, sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a uniform buffer to a uniform block binding point
+    ///
+    /// Uniform blocks assigned to the same binding point with
+    /// `sf::Shader::setUniformBlockBinding` read their values
+    /// from \p uniformBuffer. The binding is part of the state
+    /// of the active OpenGL context.
+    ///
+    /// Binding point `sf::Shader::builtInUniformBlockBinding` is
+    /// reserved for the matrices of SFML's built-in shaders.
+    ///
+    /// \param uniformBuffer Pointer to the uniform buffer to bind, can be null to use no uniform buffer
+    /// \param bindingPoint  Index of the binding point
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(GraphicsContext& graphicsContext, const UniformBuffer* uniformBuffer, unsigned int bindingPoint);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext* m_graphicsContext; //!< The window context
+    unsigned int     m_buffer{};        //!< Internal buffer identifier
+    std::size_t      m_size{};          //!< Size in bytes of the currently allocated buffer
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// sf::UniformBuffer stores the values of a GLSL uniform block
+/// in graphics memory. Compared to setting uniforms one by one,
+/// the whole block is uploaded with a single call, and can be
+/// shared by any number of shaders declaring the same block.
+///
+/// The layout of the block must be `std140`, and the C++ struct
+/// used to update it must match that layout (e.g. `vec3` members
+/// are aligned like `vec4`).
+///
+/// Example:
+/// \code
+/// // GLSL:
+/// // layout(std140) uniform Lighting
+/// // {
+/// //     vec4 ambientColor;
+/// //     vec4 lightPosition;
+/// // };
+///
+/// struct Lighting
+/// {
+///     sf::Glsl::Vec4 ambientColor;
+///     sf::Glsl::Vec4 lightPosition;
+/// };
+///
+/// sf::UniformBuffer lightingBuffer(graphicsContext);
+/// lightingBuffer.create(sizeof(Lighting));
+///
+/// shader.setUniformBlockBinding("Lighting", 1);
+/// sf::UniformBuffer::bind(graphicsContext, &lightingBuffer, 1);
+/// ...
+/// lightingBuffer.update(Lighting{ambientColor, lightPosition});
+///
+/// sf::RenderStates states;
+/// states.shader = &shader;
+/// window.draw(sprite, states);
+/// \endcode
+///
+/// \see sf::Shader
+///
+////////////////////////////////////////////////////////////
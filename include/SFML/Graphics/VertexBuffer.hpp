@@ -275,7 +275,9 @@ public:
     ///
     /// This function is not part of the graphics API, it mustn't be
     /// used when drawing SFML entities. It must be used only if you
-    /// mix sf::VertexBuffer with OpenGL code.
+    /// mix sf::VertexBuffer with OpenGL code. Render targets
+    /// keep track of the buffer bound for drawing, so call
+    /// `resetGLStates` on them before drawing SFML entities again.
     ///
     /// \code
     /// sf::VertexBuffer vb1, vb2;
@@ -0,0 +1,44 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Transform;
+struct Vertex;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Apply a transform to the positions of a range of vertices
+///
+/// The positions of the \a input vertices are transformed by
+/// \a transform and written, along with their unchanged colors
+/// and texture coordinates, to \a output.
+///
+/// The best available implementation (AVX2, SSE2, NEON or
+/// scalar) is selected once at runtime, depending on the
+/// capabilities of the CPU.
+///
+/// \param transform Transform to apply
+/// \param input     Pointer to the vertices to transform
+/// \param output    Pointer to the transformed vertices, can be
+///                  equal to \a input but must not otherwise overlap it
+/// \param count     Number of vertices to transform
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void transformVertices(const Transform& transform, const Vertex* input, Vertex* output, std::size_t count);
+
+} // namespace sf
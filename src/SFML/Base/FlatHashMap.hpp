@@ -0,0 +1,373 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Default hash function of `FlatHashMap`, for integer keys
+///
+////////////////////////////////////////////////////////////
+struct FlatHashMapIntegerHash
+{
+    [[nodiscard, gnu::always_inline, gnu::const]] constexpr std::uint64_t operator()(std::uint64_t key) const noexcept
+    {
+        // Finalizer of MurmurHash3: keys often differ only in a few bits (e.g. glyph keys
+        // only in their low bits), mix them so that they spread over the whole table
+        key ^= key >> 33u;
+        key *= 0xFF51AFD7ED558CCDull;
+        key ^= key >> 33u;
+        key *= 0xC4CEB9FE1A85EC53ull;
+        key ^= key >> 33u;
+
+        return key;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Hash map using open addressing, with its keys stored
+///        in a flat array
+///
+/// Lookups probe a contiguous array of keys (linear probing),
+/// and only touch the value once the key is found. Values are
+/// stored separately, in a contiguous array indexed by the
+/// slots. As with `std::vector`, inserting or erasing a value
+/// may move the others: pointers and references to values are
+/// invalidated by both. Store pointers as values when they must
+/// stay valid.
+///
+////////////////////////////////////////////////////////////
+template <typename TKey, typename TValue, typename THash = FlatHashMapIntegerHash>
+class [[nodiscard]] FlatHashMap
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Key-value pair stored in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Entry
+    {
+        template <typename... Args>
+        [[nodiscard]] explicit Entry(const TKey& theKey, Args&&... args) :
+        key(theKey),
+        value(SFML_BASE_FORWARD(args)...)
+        {
+        }
+
+        TKey   key;   //!< Key of the entry
+        TValue value; //!< Value of the entry
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the value associated with a key
+    ///
+    /// \param key Key to search for
+    ///
+    /// \return Pointer to the value, `nullptr` if the key is not in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] TValue* find(const TKey& key)
+    {
+        const std::size_t slot = findSlot(key);
+        return slot == notFound ? nullptr : &m_entries[m_slotEntries[slot] - 1u].value;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the value associated with a key
+    ///
+    /// \param key Key to search for
+    ///
+    /// \return Pointer to the value, `nullptr` if the key is not in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] const TValue* find(const TKey& key) const
+    {
+        const std::size_t slot = findSlot(key);
+        return slot == notFound ? nullptr : &m_entries[m_slotEntries[slot] - 1u].value;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a key is in the map
+    ///
+    /// \param key Key to search for
+    ///
+    /// \return True if the key is in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] bool contains(const TKey& key) const
+    {
+        return findSlot(key) != notFound;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert a value constructed in place, unless the key is already in the map
+    ///
+    /// \param key  Key of the value
+    /// \param args Arguments forwarded to the constructor of the value
+    ///
+    /// \return Reference to the inserted value, or to the existing one
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename... Args>
+    TValue& emplace(const TKey& key, Args&&... args)
+    {
+        if (TValue* value = find(key))
+            return *value;
+
+        // Keep the load factor under 3/4, linear probing degrades quickly past it
+        if ((m_entries.size() + 1u) * 4u > m_slotEntries.size() * 3u)
+            rehash(m_slotEntries.empty() ? minSlotCount : m_slotEntries.size() * 2u);
+
+        std::size_t slot = hashSlot(key);
+        while (m_slotEntries[slot] != 0u)
+            slot = (slot + 1u) & (m_slotEntries.size() - 1u);
+
+        m_entries.emplace_back(key, SFML_BASE_FORWARD(args)...);
+
+        m_slotKeys[slot]    = key;
+        m_slotEntries[slot] = static_cast<std::uint32_t>(m_entries.size());
+
+        return m_entries.back().value;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the value associated with a key, inserting a default-constructed one if needed
+    ///
+    /// \param key Key of the value
+    ///
+    /// \return Reference to the value
+    ///
+    ////////////////////////////////////////////////////////////
+    TValue& operator[](const TKey& key)
+    {
+        return emplace(key);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a key and its value from the map
+    ///
+    /// The last value is moved to the place of the erased one.
+    ///
+    /// \param key Key to remove
+    ///
+    /// \return True if the key was in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    bool erase(const TKey& key)
+    {
+        std::size_t slot = findSlot(key);
+        if (slot == notFound)
+            return false;
+
+        const std::size_t entryIndex = m_slotEntries[slot] - 1u;
+        const std::size_t mask       = m_slotEntries.size() - 1u;
+
+        // Shift the following keys of the probe sequence back, so that no lookup stops at the hole
+        for (std::size_t next = (slot + 1u) & mask; m_slotEntries[next] != 0u; next = (next + 1u) & mask)
+        {
+            const std::size_t ideal = hashSlot(m_slotKeys[next]);
+
+            // The key can only move back if its ideal slot is not between the hole and itself
+            if (((next - ideal) & mask) >= ((next - slot) & mask))
+            {
+                m_slotKeys[slot]    = m_slotKeys[next];
+                m_slotEntries[slot] = m_slotEntries[next];
+                slot                = next;
+            }
+        }
+
+        m_slotEntries[slot] = 0u;
+
+        // Fill the hole in the values with the last one
+        if (entryIndex != m_entries.size() - 1u)
+        {
+            m_entries[entryIndex] = SFML_BASE_MOVE(m_entries.back());
+            m_slotEntries[findSlot(m_entries[entryIndex].key)] = static_cast<std::uint32_t>(entryIndex + 1u);
+        }
+
+        m_entries.pop_back();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the keys and values, keeping the allocated slots
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear()
+    {
+        m_entries.clear();
+
+        for (std::uint32_t& slotEntry : m_slotEntries)
+            slotEntry = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate enough slots for a number of keys
+    ///
+    /// \param count Number of keys that can be inserted without rehashing
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t count)
+    {
+        std::size_t slotCount = minSlotCount;
+        while (count * 4u > slotCount * 3u)
+            slotCount *= 2u;
+
+        if (slotCount > m_slotEntries.size())
+            rehash(slotCount);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of keys in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] std::size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the map is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] bool empty() const
+    {
+        return m_entries.empty();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Iterate over the entries, in insertion order (unless some were erased)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] auto begin()
+    {
+        return m_entries.begin();
+    }
+
+    [[nodiscard]] auto end()
+    {
+        return m_entries.end();
+    }
+
+    [[nodiscard]] auto begin() const
+    {
+        return m_entries.begin();
+    }
+
+    [[nodiscard]] auto end() const
+    {
+        return m_entries.end();
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t minSlotCount = 16u;            //!< Number of slots allocated by the first insertion
+    static constexpr std::size_t notFound     = ~std::size_t{}; //!< Returned by `findSlot` for missing keys
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the first slot of the probe sequence of a key
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] std::size_t hashSlot(const TKey& key) const
+    {
+        return static_cast<std::size_t>(THash{}(key)) & (m_slotEntries.size() - 1u);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the slot holding a key
+    ///
+    /// \return Index of the slot, `notFound` if the key is not in the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findSlot(const TKey& key) const
+    {
+        if (m_entries.empty())
+            return notFound;
+
+        const std::size_t mask = m_slotEntries.size() - 1u;
+
+        // The load factor guarantees that there is always an empty slot to stop at
+        for (std::size_t slot = hashSlot(key);; slot = (slot + 1u) & mask)
+        {
+            if (m_slotEntries[slot] == 0u)
+                return notFound;
+
+            if (m_slotKeys[slot] == key)
+                return slot;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reallocate the slots, keeping the values in place
+    ///
+    /// \param slotCount New number of slots, must be a power of two
+    ///
+    ////////////////////////////////////////////////////////////
+    void rehash(std::size_t slotCount)
+    {
+        SFML_BASE_ASSERT((slotCount & (slotCount - 1u)) == 0u && "Slot count must be a power of two");
+        SFML_BASE_ASSERT(slotCount * 3u >= m_entries.size() * 4u);
+
+        m_slotKeys.assign(slotCount, TKey{});
+        m_slotEntries.assign(slotCount, 0u);
+
+        const std::size_t mask = slotCount - 1u;
+
+        for (std::size_t i = 0u; i < m_entries.size(); ++i)
+        {
+            std::size_t slot = hashSlot(m_entries[i].key);
+            while (m_slotEntries[slot] != 0u)
+                slot = (slot + 1u) & mask;
+
+            m_slotKeys[slot]    = m_entries[i].key;
+            m_slotEntries[slot] = static_cast<std::uint32_t>(i + 1u);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<TKey>          m_slotKeys;    //!< Key of each slot, meaningless for empty slots
+    std::vector<std::uint32_t> m_slotEntries; //!< Index of the entry of each slot plus one, 0 for empty slots
+    std::vector<Entry>         m_entries;     //!< Keys and values, in insertion order unless some were erased
+};
+
+} // namespace sf::base
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::base::FlatHashMap
+/// \ingroup system
+///
+/// `sf::base::FlatHashMap` is a replacement for `std::unordered_map`
+/// for small, trivially comparable keys (e.g. integers) that are
+/// looked up much more often than they are inserted, like the
+/// glyphs of a font. A lookup hashes the key, then scans adjacent
+/// keys in a single array until it finds the key or an empty slot,
+/// instead of following a linked list of heap-allocated nodes.
+///
+/// Example:
+/// \code
+/// sf::base::FlatHashMap<std::uint32_t, float> advances;
+///
+/// advances.emplace(65u, 12.f);
+///
+/// if (const float* advance = advances.find(65u))
+///     x += *advance;
+/// \endcode
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,764 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CompressedImage.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CompressedImageImpl
+{
+////////////////////////////////////////////////////////////
+constexpr std::uint8_t ddsMagic[]  = {'D', 'D', 'S', ' '};
+constexpr std::uint8_t ktx2Magic[] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+constexpr std::size_t ddsHeaderSize      = 128u; // Magic number included
+constexpr std::size_t ddsDx10HeaderSize  = 20u;
+constexpr std::size_t ktx2HeaderSize     = 80u;
+constexpr std::size_t ktx2LevelIndexSize = 24u;
+
+constexpr unsigned int maxImageSize = 32'768u; // Above the maximum texture size of any current GPU
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint32_t readU32(const std::uint8_t* bytes)
+{
+    return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8u) |
+           (static_cast<std::uint32_t>(bytes[2]) << 16u) | (static_cast<std::uint32_t>(bytes[3]) << 24u);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t readU64(const std::uint8_t* bytes)
+{
+    return static_cast<std::uint64_t>(readU32(bytes)) | (static_cast<std::uint64_t>(readU32(bytes + 4)) << 32u);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t readBigEndianU64(const std::uint8_t* bytes)
+{
+    std::uint64_t value = 0u;
+
+    for (std::size_t i = 0u; i < 8u; ++i)
+        value = (value << 8u) | bytes[i];
+
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getLevelByteCount(sf::priv::CompressedFormat format, sf::Vector2u size)
+{
+    const std::size_t blockCountX = (std::size_t{size.x} + 3u) / 4u;
+    const std::size_t blockCountY = (std::size_t{size.y} + 3u) / 4u;
+
+    return blockCountX * blockCountY * sf::priv::getCompressedBlockSize(format);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Vector2u getLevelSize(sf::Vector2u size, unsigned int level)
+{
+    return {sf::base::max(size.x >> level, 1u), sf::base::max(size.y >> level, 1u)};
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getMaxLevelCount(sf::Vector2u size)
+{
+    unsigned int count = 1u;
+
+    for (unsigned int largest = sf::base::max(size.x, size.y); largest > 1u; largest /= 2u)
+        ++count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::priv::CompressedImage> parseDds(const std::uint8_t* bytes, std::size_t size)
+{
+    using sf::priv::CompressedFormat;
+
+    sf::base::Optional<sf::priv::CompressedImage> result; // Use a single local variable for NRVO
+
+    if ((size < ddsHeaderSize) || (readU32(bytes + 4) != 124u))
+    {
+        sf::priv::err() << "Failed to read DDS file, invalid header";
+        return result; // Empty optional
+    }
+
+    const sf::Vector2u imageSize{readU32(bytes + 16), readU32(bytes + 12)};
+    const std::uint32_t pixelFormatFlags = readU32(bytes + 80);
+    const std::uint32_t caps2            = readU32(bytes + 112);
+
+    constexpr std::uint32_t fourCCFlag  = 0x4u;
+    constexpr std::uint32_t cubemapFlag = 0x200u;
+
+    if ((pixelFormatFlags & fourCCFlag) == 0u)
+    {
+        sf::priv::err() << "Failed to read DDS file, only block compressed formats are supported";
+        return result; // Empty optional
+    }
+
+    if ((caps2 & cubemapFlag) != 0u)
+    {
+        sf::priv::err() << "Failed to read DDS file, cube maps are not supported";
+        return result; // Empty optional
+    }
+
+    CompressedFormat format{};
+    bool             sRgb   = false;
+    std::size_t      offset = ddsHeaderSize;
+
+    const std::uint8_t* const fourCC = bytes + 84;
+
+    if (std::memcmp(fourCC, "DXT1", 4) == 0)
+        format = CompressedFormat::BC1;
+    else if (std::memcmp(fourCC, "DXT3", 4) == 0)
+        format = CompressedFormat::BC2;
+    else if (std::memcmp(fourCC, "DXT5", 4) == 0)
+        format = CompressedFormat::BC3;
+    else if (std::memcmp(fourCC, "DX10", 4) == 0)
+    {
+        if (size < ddsHeaderSize + ddsDx10HeaderSize)
+        {
+            sf::priv::err() << "Failed to read DDS file, invalid DX10 header";
+            return result; // Empty optional
+        }
+
+        const std::uint32_t dxgiFormat = readU32(bytes + 128);
+        const std::uint32_t dimension  = readU32(bytes + 132);
+        const std::uint32_t miscFlags  = readU32(bytes + 136);
+        const std::uint32_t arraySize  = readU32(bytes + 140);
+
+        constexpr std::uint32_t texture2DDimension = 3u;
+        constexpr std::uint32_t textureCubeFlag    = 0x4u;
+
+        if ((dimension != texture2DDimension) || ((miscFlags & textureCubeFlag) != 0u) || (arraySize > 1u))
+        {
+            sf::priv::err() << "Failed to read DDS file, only single 2D textures are supported";
+            return result; // Empty optional
+        }
+
+        switch (dxgiFormat)
+        {
+            case 71: // DXGI_FORMAT_BC1_UNORM
+            case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+                format = CompressedFormat::BC1;
+                break;
+            case 74: // DXGI_FORMAT_BC2_UNORM
+            case 75: // DXGI_FORMAT_BC2_UNORM_SRGB
+                format = CompressedFormat::BC2;
+                break;
+            case 77: // DXGI_FORMAT_BC3_UNORM
+            case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+                format = CompressedFormat::BC3;
+                break;
+            default:
+                sf::priv::err() << "Failed to read DDS file, unsupported DXGI format " << dxgiFormat;
+                return result; // Empty optional
+        }
+
+        sRgb = (dxgiFormat == 72u) || (dxgiFormat == 75u) || (dxgiFormat == 78u);
+        offset += ddsDx10HeaderSize;
+    }
+    else
+    {
+        sf::priv::err() << "Failed to read DDS file, unsupported pixel format";
+        return result; // Empty optional
+    }
+
+    // Reject absurd sizes before computing any byte count from them
+    if ((imageSize.x == 0u) || (imageSize.y == 0u) || (imageSize.x > maxImageSize) || (imageSize.y > maxImageSize))
+    {
+        sf::priv::err() << "Failed to read DDS file, invalid size (" << imageSize.x << "x" << imageSize.y << ")";
+        return result; // Empty optional
+    }
+
+    // A mipmap count of zero means that there is only the base level
+    const unsigned int levelCount = sf::base::min(sf::base::max(readU32(bytes + 28), 1u), getMaxLevelCount(imageSize));
+
+    result.emplace();
+    result->format = format;
+    result->sRgb   = sRgb;
+    result->levels.reserve(levelCount);
+
+    // The levels are stored one after the other, from the largest to the smallest
+    for (unsigned int level = 0u; level < levelCount; ++level)
+    {
+        const sf::Vector2u levelSize = getLevelSize(imageSize, level);
+        const std::size_t  byteCount = getLevelByteCount(format, levelSize);
+
+        if (byteCount > size - offset)
+        {
+            // Keep the complete levels, if any
+            if (level > 0u)
+                break;
+
+            sf::priv::err() << "Failed to read DDS file, the data is truncated";
+            result.reset();
+            return result; // Empty optional
+        }
+
+        result->levels.push_back({levelSize, bytes + offset, byteCount});
+        offset += byteCount;
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::priv::CompressedImage> parseKtx2(const std::uint8_t* bytes, std::size_t size)
+{
+    using sf::priv::CompressedFormat;
+
+    sf::base::Optional<sf::priv::CompressedImage> result; // Use a single local variable for NRVO
+
+    if (size < ktx2HeaderSize)
+    {
+        sf::priv::err() << "Failed to read KTX2 file, invalid header";
+        return result; // Empty optional
+    }
+
+    const std::uint32_t vkFormat = readU32(bytes + 12);
+    const sf::Vector2u  imageSize{readU32(bytes + 20), readU32(bytes + 24)};
+    const std::uint32_t depth            = readU32(bytes + 28);
+    const std::uint32_t layerCount       = readU32(bytes + 32);
+    const std::uint32_t faceCount        = readU32(bytes + 36);
+    const std::uint32_t storedLevelCount = readU32(bytes + 40);
+    const std::uint32_t supercompression = readU32(bytes + 44);
+
+    if ((depth > 1u) || (layerCount > 1u) || (faceCount != 1u))
+    {
+        sf::priv::err() << "Failed to read KTX2 file, only single 2D textures are supported";
+        return result; // Empty optional
+    }
+
+    if (supercompression != 0u)
+    {
+        sf::priv::err() << "Failed to read KTX2 file, supercompression is not supported";
+        return result; // Empty optional
+    }
+
+    CompressedFormat format{};
+
+    switch (vkFormat)
+    {
+        case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            format = CompressedFormat::BC1;
+            break;
+        case 135: // VK_FORMAT_BC2_UNORM_BLOCK
+        case 136: // VK_FORMAT_BC2_SRGB_BLOCK
+            format = CompressedFormat::BC2;
+            break;
+        case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+            format = CompressedFormat::BC3;
+            break;
+        case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+            format = CompressedFormat::ETC2RGB;
+            break;
+        case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+        case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+            format = CompressedFormat::ETC2RGBA;
+            break;
+        default:
+            sf::priv::err() << "Failed to read KTX2 file, unsupported Vulkan format " << vkFormat;
+            return result; // Empty optional
+    }
+
+    // Reject absurd sizes before computing any byte count from them
+    if ((imageSize.x == 0u) || (imageSize.y == 0u) || (imageSize.x > maxImageSize) || (imageSize.y > maxImageSize))
+    {
+        sf::priv::err() << "Failed to read KTX2 file, invalid size (" << imageSize.x << "x" << imageSize.y << ")";
+        return result; // Empty optional
+    }
+
+    // A level count of zero means that there is only the base level, mipmaps being left to the loader
+    const std::uint32_t levelCount = sf::base::max(storedLevelCount, 1u);
+
+    if ((levelCount > getMaxLevelCount(imageSize)) || ((size - ktx2HeaderSize) / ktx2LevelIndexSize < levelCount))
+    {
+        sf::priv::err() << "Failed to read KTX2 file, invalid level index";
+        return result; // Empty optional
+    }
+
+    result.emplace();
+    result->format = format;
+    result->sRgb   = (vkFormat % 2u) == 0u; // Every supported sRGB format follows its linear counterpart
+    result->levels.reserve(levelCount);
+
+    // The level index lists the levels from the largest to the smallest, wherever they are stored
+    for (unsigned int level = 0u; level < levelCount; ++level)
+    {
+        const std::uint8_t* const entry = bytes + ktx2HeaderSize + level * ktx2LevelIndexSize;
+
+        const std::uint64_t offset    = readU64(entry);
+        const std::uint64_t length    = readU64(entry + 8);
+        const sf::Vector2u  levelSize = getLevelSize(imageSize, level);
+        const std::size_t   byteCount = getLevelByteCount(format, levelSize);
+
+        if ((offset > size) || (length > size - offset) || (length < byteCount))
+        {
+            sf::priv::err() << "Failed to read KTX2 file, level " << level << " is out of bounds";
+            result.reset();
+            return result; // Empty optional
+        }
+
+        result->levels.push_back({levelSize, bytes + offset, byteCount});
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+using Block = std::uint8_t[16][4]; // RGBA pixels of a 4x4 block, row by row
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint8_t clampToByte(int value)
+{
+    return static_cast<std::uint8_t>(sf::base::clamp(value, 0, 255));
+}
+
+
+////////////////////////////////////////////////////////////
+void expand565(std::uint32_t color, std::uint8_t (&rgb)[4])
+{
+    const std::uint32_t r = (color >> 11u) & 31u;
+    const std::uint32_t g = (color >> 5u) & 63u;
+    const std::uint32_t b = color & 31u;
+
+    rgb[0] = static_cast<std::uint8_t>((r << 3u) | (r >> 2u));
+    rgb[1] = static_cast<std::uint8_t>((g << 2u) | (g >> 4u));
+    rgb[2] = static_cast<std::uint8_t>((b << 3u) | (b >> 2u));
+    rgb[3] = 255u;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Decode the color part of a BC1, BC2 or BC3 block
+///
+/// Only BC1 blocks can use the 3 colors + transparent mode.
+///
+////////////////////////////////////////////////////////////
+void decodeBcColor(const std::uint8_t* data, bool allowTransparent, Block& block)
+{
+    const std::uint32_t color0 = data[0] | (data[1] << 8u);
+    const std::uint32_t color1 = data[2] | (data[3] << 8u);
+
+    std::uint8_t palette[4][4]{};
+    expand565(color0, palette[0]);
+    expand565(color1, palette[1]);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        if ((color0 > color1) || !allowTransparent)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((2 * palette[0][c] + palette[1][c]) / 3);
+            palette[3][c] = static_cast<std::uint8_t>((palette[0][c] + 2 * palette[1][c]) / 3);
+        }
+        else
+        {
+            palette[2][c] = static_cast<std::uint8_t>((palette[0][c] + palette[1][c]) / 2);
+        }
+    }
+
+    palette[2][3] = 255u;
+    palette[3][3] = ((color0 > color1) || !allowTransparent) ? 255u : 0u; // Transparent black otherwise
+
+    const std::uint32_t indices = readU32(data + 4);
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+        std::memcpy(block[i], palette[(indices >> (2u * i)) & 3u], 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBc2Alpha(const std::uint8_t* data, Block& block)
+{
+    for (unsigned int i = 0u; i < 16u; ++i)
+        block[i][3] = static_cast<std::uint8_t>(((data[i / 2u] >> (4u * (i % 2u))) & 15u) * 17u);
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBc3Alpha(const std::uint8_t* data, Block& block)
+{
+    const int alpha0 = data[0];
+    const int alpha1 = data[1];
+
+    int palette[8]{alpha0, alpha1};
+
+    if (alpha0 > alpha1)
+    {
+        for (int i = 2; i < 8; ++i)
+            palette[i] = ((8 - i) * alpha0 + (i - 1) * alpha1) / 7;
+    }
+    else
+    {
+        for (int i = 2; i < 6; ++i)
+            palette[i] = ((6 - i) * alpha0 + (i - 1) * alpha1) / 5;
+
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    // 16 indices of 3 bits, stored in 6 bytes
+    std::uint64_t indices = 0u;
+    for (unsigned int i = 0u; i < 6u; ++i)
+        indices |= static_cast<std::uint64_t>(data[2 + i]) << (8u * i);
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+        block[i][3] = static_cast<std::uint8_t>(palette[(indices >> (3u * i)) & 7u]);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] int extend(std::uint64_t value, unsigned int bits)
+{
+    return static_cast<int>((value << (8u - bits)) | (value >> (2u * bits - 8u)));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t bitsOf(std::uint64_t word, unsigned int high, unsigned int low)
+{
+    return (word >> low) & ((std::uint64_t{1} << (high - low + 1u)) - 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Write a color to the block, ETC pixels being indexed column by column
+///
+////////////////////////////////////////////////////////////
+void setEtcPixel(Block& block, unsigned int etcIndex, int r, int g, int b)
+{
+    std::uint8_t* const pixel = block[(etcIndex % 4u) * 4u + etcIndex / 4u];
+
+    pixel[0] = clampToByte(r);
+    pixel[1] = clampToByte(g);
+    pixel[2] = clampToByte(b);
+    pixel[3] = 255u;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getEtcPixelIndex(std::uint64_t word, unsigned int etcIndex)
+{
+    return static_cast<unsigned int>((((word >> (16u + etcIndex)) & 1u) << 1u) | ((word >> etcIndex) & 1u));
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Decode the T and H modes, which paint each pixel with one of 4 colors
+///
+////////////////////////////////////////////////////////////
+void decodeEtc2Paint(std::uint64_t word, bool hMode, Block& block)
+{
+    constexpr int distances[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+    int color0[3]{};
+    int color1[3]{};
+    int distance = 0;
+
+    if (!hMode)
+    {
+        const std::uint64_t r0 = (bitsOf(word, 60, 59) << 2u) | bitsOf(word, 57, 56);
+
+        color0[0] = extend(r0, 4);
+        color0[1] = extend(bitsOf(word, 55, 52), 4);
+        color0[2] = extend(bitsOf(word, 51, 48), 4);
+        color1[0] = extend(bitsOf(word, 47, 44), 4);
+        color1[1] = extend(bitsOf(word, 43, 40), 4);
+        color1[2] = extend(bitsOf(word, 39, 36), 4);
+        distance  = distances[(bitsOf(word, 35, 34) << 1u) | bitsOf(word, 32, 32)];
+    }
+    else
+    {
+        const std::uint64_t r0 = bitsOf(word, 62, 59);
+        const std::uint64_t g0 = (bitsOf(word, 58, 56) << 1u) | bitsOf(word, 52, 52);
+        const std::uint64_t b0 = (bitsOf(word, 51, 51) << 3u) | bitsOf(word, 49, 47);
+        const std::uint64_t r1 = bitsOf(word, 46, 43);
+        const std::uint64_t g1 = bitsOf(word, 42, 39);
+        const std::uint64_t b1 = bitsOf(word, 38, 35);
+
+        // The order of the two colors encodes the last bit of the distance index
+        const bool          ordered = ((r0 << 8u) | (g0 << 4u) | b0) >= ((r1 << 8u) | (g1 << 4u) | b1);
+        const std::uint64_t index   = (bitsOf(word, 34, 34) << 2u) | (bitsOf(word, 32, 32) << 1u) | (ordered ? 1u : 0u);
+
+        color0[0] = extend(r0, 4);
+        color0[1] = extend(g0, 4);
+        color0[2] = extend(b0, 4);
+        color1[0] = extend(r1, 4);
+        color1[1] = extend(g1, 4);
+        color1[2] = extend(b1, 4);
+        distance  = distances[index];
+    }
+
+    int paint[4][3]{};
+
+    for (int c = 0; c < 3; ++c)
+    {
+        if (!hMode)
+        {
+            paint[0][c] = color0[c];
+            paint[1][c] = color1[c] + distance;
+            paint[2][c] = color1[c];
+            paint[3][c] = color1[c] - distance;
+        }
+        else
+        {
+            paint[0][c] = color0[c] + distance;
+            paint[1][c] = color0[c] - distance;
+            paint[2][c] = color1[c] + distance;
+            paint[3][c] = color1[c] - distance;
+        }
+    }
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+        const int* const color = paint[getEtcPixelIndex(word, i)];
+        setEtcPixel(block, i, color[0], color[1], color[2]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeEtc2Planar(std::uint64_t word, Block& block)
+{
+    // The blue component of the origin is split around the differential bits
+    const std::uint64_t originBlue = (bitsOf(word, 48, 48) << 5u) | (bitsOf(word, 44, 43) << 3u) | bitsOf(word, 41, 39);
+
+    const int origin[3] = {extend(bitsOf(word, 62, 57), 6),
+                           extend((bitsOf(word, 56, 56) << 6u) | bitsOf(word, 54, 49), 7),
+                           extend(originBlue, 6)};
+
+    const int horizontal[3] = {extend((bitsOf(word, 38, 34) << 1u) | bitsOf(word, 32, 32), 6),
+                               extend(bitsOf(word, 31, 25), 7),
+                               extend(bitsOf(word, 24, 19), 6)};
+
+    const int vertical[3] = {extend(bitsOf(word, 18, 13), 6),
+                             extend(bitsOf(word, 12, 6), 7),
+                             extend(bitsOf(word, 5, 0), 6)};
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+        const int x = static_cast<int>(i / 4u);
+        const int y = static_cast<int>(i % 4u);
+
+        int color[3]{};
+        for (int c = 0; c < 3; ++c)
+            color[c] = (x * (horizontal[c] - origin[c]) + y * (vertical[c] - origin[c]) + 4 * origin[c] + 2) >> 2;
+
+        setEtcPixel(block, i, color[0], color[1], color[2]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeEtc2Color(const std::uint8_t* data, Block& block)
+{
+    constexpr int modifiers[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+
+    const std::uint64_t word = readBigEndianU64(data);
+
+    int base0[3]{};
+    int base1[3]{};
+
+    if (bitsOf(word, 33, 33) == 0u)
+    {
+        // Individual mode: two 4-bit colors
+        for (unsigned int c = 0u; c < 3u; ++c)
+        {
+            base0[c] = extend(bitsOf(word, 63u - 8u * c, 60u - 8u * c), 4);
+            base1[c] = extend(bitsOf(word, 59u - 8u * c, 56u - 8u * c), 4);
+        }
+    }
+    else
+    {
+        // Differential mode: a 5-bit color and a 3-bit signed offset, overflows select the ETC2 modes
+        for (unsigned int c = 0u; c < 3u; ++c)
+        {
+            const auto value = static_cast<int>(bitsOf(word, 63u - 8u * c, 59u - 8u * c));
+            const auto delta = static_cast<int>(bitsOf(word, 58u - 8u * c, 56u - 8u * c) ^ 4u) - 4;
+
+            if ((value + delta < 0) || (value + delta > 31))
+            {
+                if (c == 0u)
+                    decodeEtc2Paint(word, /* hMode */ false, block);
+                else if (c == 1u)
+                    decodeEtc2Paint(word, /* hMode */ true, block);
+                else
+                    decodeEtc2Planar(word, block);
+
+                return;
+            }
+
+            base0[c] = extend(static_cast<std::uint64_t>(value), 5);
+            base1[c] = extend(static_cast<std::uint64_t>(value + delta), 5);
+        }
+    }
+
+    const bool flipped       = bitsOf(word, 32, 32) != 0u;
+    const int* modifierPairs[2] = {modifiers[bitsOf(word, 39, 37)], modifiers[bitsOf(word, 36, 34)]};
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+        // Sub-blocks are either the left and right halves, or the top and bottom halves when flipped
+        const unsigned int subBlock = flipped ? static_cast<unsigned int>(i % 4u >= 2u)
+                                              : static_cast<unsigned int>(i / 4u >= 2u);
+
+        const int*         baseColor = (subBlock == 0u) ? base0 : base1;
+        const unsigned int index     = getEtcPixelIndex(word, i);
+        const int          modifier  = modifierPairs[subBlock][index & 1u] * ((index & 2u) ? -1 : 1);
+
+        setEtcPixel(block, i, baseColor[0] + modifier, baseColor[1] + modifier, baseColor[2] + modifier);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeEacAlpha(const std::uint8_t* data, Block& block)
+{
+    constexpr int modifiers[16][8] = {{-3, -6, -9, -15, 2, 5, 8, 14},
+                                      {-3, -7, -10, -13, 2, 6, 9, 12},
+                                      {-2, -5, -8, -13, 1, 4, 7, 12},
+                                      {-2, -4, -6, -13, 1, 3, 5, 12},
+                                      {-3, -6, -8, -12, 2, 5, 7, 11},
+                                      {-3, -7, -9, -11, 2, 6, 8, 10},
+                                      {-4, -7, -8, -11, 3, 6, 7, 10},
+                                      {-3, -5, -8, -11, 2, 4, 7, 10},
+                                      {-2, -6, -8, -10, 1, 5, 7, 9},
+                                      {-2, -5, -8, -10, 1, 4, 7, 9},
+                                      {-2, -4, -8, -10, 1, 3, 7, 9},
+                                      {-2, -5, -7, -10, 1, 4, 6, 9},
+                                      {-3, -4, -7, -10, 2, 3, 6, 9},
+                                      {-1, -2, -3, -10, 0, 1, 2, 9},
+                                      {-4, -6, -8, -9, 3, 5, 7, 8},
+                                      {-3, -5, -7, -9, 2, 4, 6, 8}};
+
+    const std::uint64_t word       = readBigEndianU64(data);
+    const auto          base       = static_cast<int>(bitsOf(word, 63, 56));
+    const auto          multiplier = static_cast<int>(bitsOf(word, 55, 52));
+    const int* const    modifier   = modifiers[bitsOf(word, 51, 48)];
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+        const std::uint64_t index = bitsOf(word, 47u - 3u * i, 45u - 3u * i);
+        block[(i % 4u) * 4u + i / 4u][3] = clampToByte(base + modifier[index] * multiplier);
+    }
+}
+
+} // namespace CompressedImageImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool isCompressedImage(const void* data, std::size_t size)
+{
+    using namespace CompressedImageImpl;
+
+    return (data != nullptr) &&
+           (((size >= sizeof(ddsMagic)) && (std::memcmp(data, ddsMagic, sizeof(ddsMagic)) == 0)) ||
+            ((size >= sizeof(ktx2Magic)) && (std::memcmp(data, ktx2Magic, sizeof(ktx2Magic)) == 0)));
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<CompressedImage> parseCompressedImage(const void* data, std::size_t size)
+{
+    if (!isCompressedImage(data, size))
+    {
+        priv::err() << "Failed to read compressed image, unknown container format";
+        return base::nullOpt;
+    }
+
+    const auto* const bytes = static_cast<const std::uint8_t*>(data);
+
+    if (bytes[0] == 'D')
+        return CompressedImageImpl::parseDds(bytes, size);
+
+    return CompressedImageImpl::parseKtx2(bytes, size);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getCompressedBlockSize(CompressedFormat format)
+{
+    return (format == CompressedFormat::BC1) || (format == CompressedFormat::ETC2RGB) ? 8u : 16u;
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeCompressedLevel(CompressedFormat format, const CompressedLevel& level, std::uint8_t* pixels)
+{
+    using namespace CompressedImageImpl;
+
+    SFML_BASE_ASSERT(level.byteCount >= getLevelByteCount(format, level.size));
+
+    const std::size_t   blockSize = getCompressedBlockSize(format);
+    const std::uint8_t* data      = level.data;
+
+    for (unsigned int blockY = 0u; blockY < level.size.y; blockY += 4u)
+    {
+        for (unsigned int blockX = 0u; blockX < level.size.x; blockX += 4u)
+        {
+            Block block{};
+
+            switch (format)
+            {
+                case CompressedFormat::BC1:
+                    decodeBcColor(data, /* allowTransparent */ true, block);
+                    break;
+                case CompressedFormat::BC2:
+                    decodeBcColor(data + 8, /* allowTransparent */ false, block);
+                    decodeBc2Alpha(data, block);
+                    break;
+                case CompressedFormat::BC3:
+                    decodeBcColor(data + 8, /* allowTransparent */ false, block);
+                    decodeBc3Alpha(data, block);
+                    break;
+                case CompressedFormat::ETC2RGB:
+                    decodeEtc2Color(data, block);
+                    break;
+                case CompressedFormat::ETC2RGBA:
+                    decodeEtc2Color(data + 8, block);
+                    decodeEacAlpha(data, block);
+                    break;
+            }
+
+            data += blockSize;
+
+            // Blocks on the right and bottom edges may be partially outside of the level
+            const unsigned int width  = base::min(level.size.x - blockX, 4u);
+            const unsigned int height = base::min(level.size.y - blockY, 4u);
+
+            for (unsigned int y = 0u; y < height; ++y)
+            {
+                const std::size_t pixelIndex = (std::size_t{blockY} + y) * level.size.x + blockX;
+                std::memcpy(pixels + pixelIndex * 4u, block[y * 4u], width * 4u);
+            }
+        }
+    }
+}
+
+} // namespace sf::priv
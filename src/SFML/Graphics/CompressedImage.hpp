@@ -0,0 +1,99 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Block compressed pixel formats supported in containers
+///
+////////////////////////////////////////////////////////////
+enum class CompressedFormat : unsigned char
+{
+    BC1,     //!< S3TC DXT1, RGB with 1-bit alpha, 8 bytes per 4x4 block
+    BC2,     //!< S3TC DXT3, RGB with explicit 4-bit alpha, 16 bytes per block
+    BC3,     //!< S3TC DXT5, RGB with interpolated alpha, 16 bytes per block
+    ETC2RGB, //!< ETC2 RGB8, 8 bytes per block
+    ETC2RGBA //!< ETC2 RGBA8 with EAC alpha, 16 bytes per block
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Mipmap level of a compressed image
+///
+////////////////////////////////////////////////////////////
+struct CompressedLevel
+{
+    Vector2u            size;        //!< Size of the level, in pixels
+    const std::uint8_t* data{};      //!< Compressed blocks, pointing into the container
+    std::size_t         byteCount{}; //!< Size of the compressed blocks, in bytes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Pre-compressed image read from a KTX2 or DDS container
+///
+/// The levels point into the container data, which must
+/// outlive the compressed image.
+///
+////////////////////////////////////////////////////////////
+struct CompressedImage
+{
+    CompressedFormat             format{}; //!< Block format of all the levels
+    bool                         sRgb{};   //!< True if the container flags the pixels as sRGB encoded
+    std::vector<CompressedLevel> levels;   //!< Mipmap levels, from the largest to the smallest
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether some data starts like a KTX2 or DDS container
+///
+/// \param data Container data
+/// \param size Size of the container data, in bytes
+///
+/// \return True if the data has the magic number of a supported container
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCompressedImage(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Read the levels of a KTX2 or DDS container
+///
+/// \param data Container data
+/// \param size Size of the container data, in bytes
+///
+/// \return Compressed image if the container is valid and its format is supported, otherwise `base::nullOpt`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Optional<CompressedImage> parseCompressedImage(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size of a 4x4 block of a compressed format
+///
+/// \return Size of a block, in bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getCompressedBlockSize(CompressedFormat format);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress a level to RGBA pixels on the CPU
+///
+/// Used when the graphics driver doesn't support the format.
+///
+/// \param format Block format of the level
+/// \param level  Level to decompress
+/// \param pixels Array of `level.size.x * level.size.y * 4` bytes receiving the pixels
+///
+////////////////////////////////////////////////////////////
+void decodeCompressedLevel(CompressedFormat format, const CompressedLevel& level, std::uint8_t* pixels);
+
+} // namespace sf::priv
@@ -7,7 +7,6 @@
 #include "SFML/Graphics/FontInfo.hpp"
 #include "SFML/Graphics/Glyph.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
-#include "SFML/Graphics/Image.hpp"
 #include "SFML/Graphics/Texture.hpp"
 #ifdef SFML_SYSTEM_ANDROID
 #include "SFML/System/Android/ResourceStream.hpp"
@@ -17,8 +16,10 @@
 #include "SFML/System/Path.hpp"
 #include "SFML/System/PathUtils.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Math/Floor.hpp"
+#include "SFML/Base/UniquePtr.hpp"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -26,11 +27,18 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include FT_MODULE_H
 
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/FlatHashMap.hpp"
 
+#include <algorithm> // std::sort
+#include <atomic>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <cstring>
@@ -70,13 +78,45 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
+
+// The glyph indices of the Basic Multilingual Plane are cached in blocks of consecutive code points
+constexpr std::uint32_t charIndexBlockSize  = 256;
+constexpr std::uint32_t charIndexBlockCount = 0x10000 / charIndexBlockSize;
+
+// Marks a code point whose glyph index has not been looked up yet (FreeType uses 0 for missing glyphs)
+constexpr std::uint32_t unknownCharIndex = 0xFFFFFFFF;
+
+// Code points looked up directly in each page, without going through the glyph table
+constexpr std::size_t asciiGlyphCount = 128;
+
+// Width and height of a new atlas, atlases never shrink below it
+constexpr unsigned int initialAtlasSize = 128;
+
+// Transparent space left around each glyph in its atlas, so that filtering doesn't pollute it with its neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Character size at which distance field glyphs are rasterized, they are scaled to all the other sizes
+constexpr unsigned int distanceFieldCharacterSize = 48;
+
+// Distance from the glyph outline at which the distance field saturates, in pixels at the reference size
+constexpr int distanceFieldSpread = 6;
+
+// Set the spread of the distance fields rendered by a FreeType library
+void setDistanceFieldSpread(FT_Library library)
+{
+    const FT_Int spread = distanceFieldSpread;
+
+    // Outline glyphs and bitmap glyphs are handled by two different renderers
+    FT_Property_Set(library, "sdf", "spread", &spread);
+    FT_Property_Set(library, "bsdf", "spread", &spread);
+}
 } // namespace
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-struct Font::Page
+struct Font::Atlas
 {
     struct [[nodiscard]] Row
     {
@@ -89,15 +129,193 @@ struct Font::Page
         unsigned int height;  //!< Height of the row
     };
 
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    [[nodiscard]] static std::shared_ptr<Atlas> create(GraphicsContext& graphicsContext, bool smooth);
+    explicit Atlas(Texture&& texture, std::vector<std::uint8_t>&& pixels);
+
+    [[nodiscard]] bool allocate(Vector2u areaSize, IntRect& rect);
+    void               grow(Vector2u newSize);
+    void               reset(Vector2u newSize);
+    void               markDirty(Vector2u position, Vector2u areaSize);
+    void flush(GraphicsContext& graphicsContext, bool smooth, std::vector<std::uint8_t>& stagingBuffer, GlyphStatistics& statistics);
+
+    Texture                   texture;           //!< Texture containing the pixels of the glyphs, as of the last flush
+    std::vector<std::uint8_t> pixels;            //!< Coverage of each pixel of the atlas, ahead of the texture until the next flush
+    Vector2u                  size;              //!< Size of the atlas, ahead of the texture size until the next flush
+    Vector2u                  dirtyBegin;        //!< Top-left corner of the area modified since the last flush
+    Vector2u                  dirtyEnd;          //!< Bottom-right corner of the area modified since the last flush (empty area if clean)
+    bool                      recreateTexture{}; //!< Must the texture be recreated on the next flush?
+    unsigned int              nextRow{3};        //!< Y position of the next new row in the texture
+    std::vector<Row>          rows;              //!< List containing the position of all the existing rows
+    std::uint64_t             generation{};      //!< Number of compactions, which move the glyphs
+    bool                      isFull{};          //!< Did a glyph not fit at the maximum texture size?
+};
+
+
+////////////////////////////////////////////////////////////
+struct Font::Page
+{
+    struct [[nodiscard]] CachedGlyph
+    {
+        explicit CachedGlyph(const Glyph& theGlyph, std::uint64_t theLastUse, std::uint64_t theAtlasGeneration) :
+        glyph(theGlyph),
+        lastUse(theLastUse),
+        atlasGeneration(theAtlasGeneration)
+        {
+        }
+
+        Glyph         glyph;           //!< Metrics and texture rectangle of the glyph
+        std::uint64_t lastUse;         //!< Value of the use clock of the font when the glyph was last looked up
+        std::uint64_t atlasGeneration; //!< Generation of the atlas the texture rectangle refers to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Table mapping a glyph key to its glyph
+    ///
+    /// The glyphs never move: references returned by `getGlyph`
+    /// stay valid until the glyph itself is evicted.
+    ///
+    ////////////////////////////////////////////////////////////
+    class [[nodiscard]] GlyphTable
+    {
+    public:
+        GlyphTable() = default;
+
+        GlyphTable(const GlyphTable& rhs)
+        {
+            *this = rhs;
+        }
+
+        GlyphTable& operator=(const GlyphTable& rhs)
+        {
+            if (this == &rhs)
+                return *this;
+
+            // The index of the other table points to its own storage, copy the glyphs one by one
+            m_index.clear();
+            m_storage.clear();
+            m_freeGlyphs.clear();
+
+            for (const auto& [key, cachedGlyph] : rhs.m_index)
+                (void)emplace(key, cachedGlyph->glyph, cachedGlyph->lastUse, cachedGlyph->atlasGeneration);
+
+            return *this;
+        }
+
+        GlyphTable(GlyphTable&&) noexcept            = default;
+        GlyphTable& operator=(GlyphTable&&) noexcept = default;
+
+        [[nodiscard, gnu::always_inline]] CachedGlyph* find(std::uint64_t key) const
+        {
+            CachedGlyph* const* cachedGlyph = m_index.find(key);
+            return cachedGlyph != nullptr ? *cachedGlyph : nullptr;
+        }
+
+        CachedGlyph& emplace(std::uint64_t key, const Glyph& glyph, std::uint64_t lastUse, std::uint64_t atlasGeneration)
+        {
+            SFML_BASE_ASSERT(!m_index.contains(key));
+
+            // Reuse the storage of an evicted glyph if possible
+            if (m_freeGlyphs.empty())
+            {
+                m_storage.push_back(base::makeUnique<CachedGlyph>(glyph, lastUse, atlasGeneration));
+                return *m_index.emplace(key, m_storage.back().get());
+            }
+
+            CachedGlyph* cachedGlyph = m_freeGlyphs.back();
+            m_freeGlyphs.pop_back();
+
+            *cachedGlyph = CachedGlyph(glyph, lastUse, atlasGeneration);
+            return *m_index.emplace(key, cachedGlyph);
+        }
+
+        void erase(std::uint64_t key)
+        {
+            if (CachedGlyph* cachedGlyph = find(key))
+            {
+                m_freeGlyphs.push_back(cachedGlyph);
+                m_index.erase(key);
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return m_index.size();
+        }
+
+        [[nodiscard]] auto begin() const
+        {
+            return m_index.begin();
+        }
+
+        [[nodiscard]] auto end() const
+        {
+            return m_index.end();
+        }
+
+    private:
+        base::FlatHashMap<std::uint64_t, CachedGlyph*> m_index;      //!< Glyph of each key
+        std::vector<base::UniquePtr<CachedGlyph>>      m_storage;    //!< Glyphs, which never move
+        std::vector<CachedGlyph*>                      m_freeGlyphs; //!< Glyphs of m_storage evicted since, to reuse
+    };
+
+    explicit Page(std::shared_ptr<Atlas>&& theAtlas) :
+    atlas(SFML_BASE_MOVE(theAtlas)),
+    atlasGeneration(atlas->generation)
+    {
+    }
+
+    // The ASCII table of the other page points to its own glyphs, it is filled again by the lookups
+    Page(const Page& rhs) :
+    glyphs(rhs.glyphs),
+    atlas(rhs.atlas),
+    atlasGeneration(rhs.atlasGeneration),
+    lastUse(rhs.lastUse)
+    {
+    }
+
+    Page& operator=(const Page& rhs)
+    {
+        glyphs          = rhs.glyphs;
+        atlas           = rhs.atlas;
+        atlasGeneration = rhs.atlasGeneration;
+        lastUse         = rhs.lastUse;
+
+        asciiGlyphs.clear();
+        return *this;
+    }
+
+    Page(Page&&) noexcept            = default;
+    Page& operator=(Page&&) noexcept = default;
+
+    [[nodiscard, gnu::always_inline]] const Glyph& use(CachedGlyph& cachedGlyph, std::uint64_t useClock)
+    {
+        cachedGlyph.lastUse = useClock;
+        lastUse             = useClock;
+
+        return cachedGlyph.glyph;
+    }
+
+    [[nodiscard, gnu::always_inline]] bool isStale(const CachedGlyph& cachedGlyph) const
+    {
+        return cachedGlyph.atlasGeneration != atlas->generation;
+    }
 
-    [[nodiscard]] static base::Optional<Page> create(GraphicsContext& graphicsContext, bool smooth);
-    explicit Page(Texture&& texture);
+    void syncAtlasGeneration()
+    {
+        // Another font sharing the atlas compacted it: the glyphs of the page were moved or evicted,
+        // they are loaded again on their next lookup
+        if (atlasGeneration != atlas->generation)
+        {
+            asciiGlyphs.clear();
+            atlasGeneration = atlas->generation;
+        }
+    }
 
-    GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-    Texture          texture;    //!< Texture containing the pixels of the glyphs
-    unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-    std::vector<Row> rows;       //!< List containing the position of all the existing rows
+    GlyphTable                glyphs;          //!< Table mapping code points to their corresponding glyph
+    std::vector<CachedGlyph*> asciiGlyphs;     //!< Unoutlined ASCII glyphs of `glyphs`, indexed by code point (then by bold flag)
+    std::shared_ptr<Atlas>    atlas;           //!< Texture holding the pixels of the glyphs, possibly shared with other pages
+    std::uint64_t             atlasGeneration; //!< Generation of the atlas the ASCII table refers to
+    std::uint64_t             lastUse{};       //!< Value of the use clock of the font when the page was last used
 };
 
 
@@ -126,10 +344,78 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
+    FT_Library   library{};    //< Pointer to the internal library interface
+    FT_StreamRec streamRec{};  //< Stream rec object describing an input stream
+    FT_Face      face{};       //< Pointer to the internal font face
+    FT_Stroker   stroker{};    //< Pointer to the stroker
+    std::string  fileName;     //< Path of the font file (if opened from a file), used to open other faces
+    const void*  memoryData{}; //< Font file data (if opened from memory), used to open other faces
+    std::size_t  memorySize{}; //< Size of the font file data (if opened from memory)
+};
+
+
+////////////////////////////////////////////////////////////
+struct Font::RasterizedGlyph
+{
+    void rasterize(FT_Library    library,
+                   FT_Face       face,
+                   FT_Stroker    stroker,
+                   std::uint32_t codePoint,
+                   bool          bold,
+                   float         outlineThickness,
+                   bool          distanceField);
+
+    Glyph                     glyph;    //!< Metrics of the glyph, its texture rectangle is not set
+    Vector2u                  size;     //!< Size of the glyph's bitmap
+    std::vector<std::uint8_t> coverage; //!< Coverage of each pixel of the bitmap, row by row
+};
+
+
+////////////////////////////////////////////////////////////
+struct Font::PrewarmJob
+{
+    explicit PrewarmJob(const FontHandles&  fontHandles,
+                        std::u32string_view characters,
+                        unsigned int        theCharacterSize,
+                        bool                bold,
+                        float               outlineThickness,
+                        bool                theDistanceField) :
+    characterSize(theCharacterSize),
+    distanceField(theDistanceField),
+    thread(
+        [this,
+         fileName   = fontHandles.fileName,
+         memoryData = fontHandles.memoryData,
+         memorySize = fontHandles.memorySize,
+         codePoints = std::u32string(characters),
+         bold,
+         outlineThickness] { run(fileName, memoryData, memorySize, codePoints, bold, outlineThickness); })
+    {
+    }
+
+    ~PrewarmJob()
+    {
+        cancelled.store(true, std::memory_order_relaxed);
+        thread.join();
+    }
+
+    PrewarmJob(const PrewarmJob&)            = delete;
+    PrewarmJob& operator=(const PrewarmJob&) = delete;
+
+    void run(const std::string&  fileName,
+             const void*         memoryData,
+             std::size_t         memorySize,
+             std::u32string_view codePoints,
+             bool                bold,
+             float               outlineThickness);
+
+    std::mutex                                             mutex;            //!< Mutex protecting the results
+    std::vector<std::pair<std::uint64_t, RasterizedGlyph>> results;          //!< Glyphs rasterized so far, with their key
+    const unsigned int                                     characterSize;    //!< Character size of the glyphs
+    const bool                                             distanceField;    //!< Are the glyphs distance fields?
+    std::atomic<bool>                                      cancelled{false}; //!< Should the worker stop early?
+    std::atomic<bool>                                      finished{false};  //!< Did the worker push its last result?
+    std::thread                                            thread;           //!< Worker thread, started last
 };
 
 
@@ -143,14 +429,37 @@ struct Font::Impl
     {
     }
 
-    using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
+    using PageTable        = base::FlatHashMap<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
+    using ScaledGlyphTable = base::FlatHashMap<unsigned int, Page::GlyphTable>; //!< Table mapping a character size to scaled glyphs
+    using KerningTable     = base::FlatHashMap<std::uint64_t, float>; //!< Table mapping a pair of glyph indices to their kerning
+    using KerningTableMap  = base::FlatHashMap<unsigned int, KerningTable>; //!< Table mapping a character size to its kerning pairs
+    using CharIndexBlocks  = std::vector<std::vector<std::uint32_t>>; //!< Blocks of glyph indices, indexed by code point
+
+    GraphicsContext*                  graphicsContext;     //!< The window context
+    std::shared_ptr<FontHandles>      fontHandles;         //!< Shared information about the internal font instance
+    bool                              isSmooth{true};      //!< Status of the smooth filter
+    bool                              isDistanceField{};   //!< Are glyphs rasterized as distance fields?
+    FontInfo                          info;                //!< Information about the font
+    mutable PageTable                 pages;               //!< Table containing the glyphs pages by character size
+    std::shared_ptr<Atlas>            sharedAtlas;         //!< Atlas used by the pages of all sizes, null if each size has its own
+    mutable base::Optional<Page>      distanceFieldPage;   //!< Page containing the distance field glyphs, shared by all sizes
+    mutable ScaledGlyphTable          distanceFieldGlyphs; //!< Distance field glyphs with metrics scaled to each character size
+    mutable KerningTableMap           kerningTables;       //!< Kerning of the glyph pairs already computed, by character size
+    mutable CharIndexBlocks           charIndexBlocks;     //!< Glyph indices of the Basic Multilingual Plane code points
+    mutable std::vector<std::uint8_t> pixelBuffer; //!< Pixel buffer gathering the modified rows of a page before being written to the texture
+    mutable GlyphStatistics statistics;            //!< Glyph rasterization and upload counters
+    mutable RasterizedGlyph rasterizedGlyph;       //!< Glyph being loaded, reused to avoid allocations
+    std::size_t             glyphCacheBudget{};    //!< Size of the glyph textures, 0 for no limit
+    mutable std::size_t     pageTextureBytes{};    //!< Size of the atlases of the pages, the shared atlas aside
+    mutable std::uint64_t   useClock{};            //!< Advanced by each flush, to find unused glyphs
+
+    struct PendingPrewarm
+    {
+        std::shared_ptr<PrewarmJob> job;            //!< Job rasterizing the glyphs, shared with copies of the font
+        std::size_t                 collectedCount; //!< Number of results of the job already added to the pages
+    };
 
-    GraphicsContext*             graphicsContext; //!< The window context
-    std::shared_ptr<FontHandles> fontHandles;     //!< Shared information about the internal font instance
-    bool                         isSmooth{true};  //!< Status of the smooth filter
-    FontInfo                     info;            //!< Information about the font
-    mutable PageTable            pages;           //!< Table containing the glyphs pages by character size
-    mutable std::vector<std::uint8_t> pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    mutable std::vector<PendingPrewarm> pendingPrewarms; //!< Glyphs being rasterized in the background
 #ifdef SFML_SYSTEM_ANDROID
     base::UniquePtr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
 #endif
@@ -207,7 +516,8 @@ base::Optional<Font> Font::openFromFile(GraphicsContext& graphicsContext, const
         priv::err() << "Failed to load font (failed to create the font face)\n" << priv::PathDebugFormatter{filename};
         return base::nullOpt;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->fileName = filename.to<std::string>();
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -263,7 +573,9 @@ base::Optional<Font> Font::openFromMemory(GraphicsContext& graphicsContext, cons
         priv::err() << "Failed to load font from memory (failed to create the font face)";
         return base::nullOpt;
     }
-    fontHandles->face = face;
+    fontHandles->face       = face;
+    fontHandles->memoryData = data;
+    fontHandles->memorySize = sizeInBytes;
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -352,11 +664,35 @@ const FontInfo& Font::getInfo() const
 }
 
 
+////////////////////////////////////////////////////////////
+GraphicsContext& Font::getGraphicsContext() const
+{
+    return *m_impl->graphicsContext;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Font::getCharIndex(std::uint32_t codePoint) const
 {
     SFML_BASE_ASSERT(m_impl->fontHandles != nullptr);
-    return FT_Get_Char_Index(m_impl->fontHandles->face, codePoint);
+
+    // Code points outside of the Basic Multilingual Plane are rare, don't cache them
+    if (codePoint >= charIndexBlockCount * charIndexBlockSize)
+        return FT_Get_Char_Index(m_impl->fontHandles->face, codePoint);
+
+    // Blocks of the table are only allocated for the ranges of code points actually used
+    if (m_impl->charIndexBlocks.empty())
+        m_impl->charIndexBlocks.resize(charIndexBlockCount);
+
+    std::vector<std::uint32_t>& block = m_impl->charIndexBlocks[codePoint / charIndexBlockSize];
+    if (block.empty())
+        block.resize(charIndexBlockSize, unknownCharIndex);
+
+    std::uint32_t& charIndex = block[codePoint % charIndexBlockSize];
+    if (charIndex == unknownCharIndex)
+        charIndex = FT_Get_Char_Index(m_impl->fontHandles->face, codePoint);
+
+    return charIndex;
 }
 
 
@@ -365,22 +701,111 @@ const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize,
 {
     SFML_BASE_ASSERT(m_impl->fontHandles != nullptr);
 
+    // Distance field glyphs are shared by all the character sizes, and outlined by the shader
+    if (m_impl->isDistanceField)
+        return getDistanceFieldGlyph(codePoint, characterSize, bold);
+
     // Get the page corresponding to the character size
-    Page::GlyphTable& glyphs = loadPage(*m_impl->graphicsContext, characterSize).glyphs;
+    // (pages move when a page is added for another size: look it up again after collecting prewarmed glyphs)
+    Page* page = &loadPage(*m_impl->graphicsContext, characterSize);
+
+    // Most text is unoutlined ASCII: look it up directly by code point, without hashing
+    const bool        isAscii    = codePoint < asciiGlyphCount && outlineThickness == 0.f;
+    const std::size_t asciiIndex = isAscii ? codePoint * 2u + std::size_t{bold} : 0u;
+
+    if (isAscii && !page->asciiGlyphs.empty())
+        if (Page::CachedGlyph* cachedGlyph = page->asciiGlyphs[asciiIndex])
+        {
+            ++m_impl->statistics.cacheHits;
+            return page->use(*cachedGlyph, m_impl->useClock);
+        }
+
+    // Remember the glyph in the ASCII table, glyphs never move in the glyph table
+    const auto cacheAscii = [&](Page::CachedGlyph& cachedGlyph) -> const Glyph&
+    {
+        if (isAscii)
+        {
+            page->asciiGlyphs.resize(asciiGlyphCount * 2u, nullptr);
+            page->asciiGlyphs[asciiIndex] = &cachedGlyph;
+        }
+
+        return page->use(cachedGlyph, m_impl->useClock);
+    };
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
     const std::uint64_t key = combine(outlineThickness, bold, getCharIndex(codePoint));
 
     // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
+    Page::CachedGlyph* cachedGlyph = page->glyphs.find(key);
+
+    if (cachedGlyph != nullptr && !page->isStale(*cachedGlyph))
     {
         // Found: just return it
-        return it->second;
+        ++m_impl->statistics.cacheHits;
+        return cacheAscii(*cachedGlyph);
+    }
+
+    ++m_impl->statistics.cacheMisses;
+
+    // Not found: it may have been rasterized in the background already
+    if (cachedGlyph == nullptr && !m_impl->pendingPrewarms.empty())
+    {
+        collectPrewarmedGlyphs();
+        page = &loadPage(*m_impl->graphicsContext, characterSize);
+
+        if ((cachedGlyph = page->glyphs.find(key)) != nullptr)
+            return cacheAscii(*cachedGlyph);
     }
 
-    // Not found: we have to load it
+    // Still not found: we have to load it
     const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-    return glyphs.emplace(key, glyph).first->second;
+
+    if (cachedGlyph == nullptr)
+        return cacheAscii(page->glyphs.emplace(key, glyph, m_impl->useClock, page->atlas->generation));
+
+    // The glyph was evicted from the atlas by another font sharing it: load it again at the same address
+    cachedGlyph->glyph           = glyph;
+    cachedGlyph->atlasGeneration = page->atlas->generation;
+    return cacheAscii(*cachedGlyph);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::prewarm(std::u32string_view characters, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    for (const char32_t codePoint : characters)
+        (void)getGlyph(codePoint, characterSize, bold, outlineThickness);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::prewarmInBackground(std::u32string_view characters, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    SFML_BASE_ASSERT(m_impl->fontHandles != nullptr);
+    const FontHandles& fontHandles = *m_impl->fontHandles;
+
+    // Streams cannot be read by two faces at the same time
+    if (fontHandles.fileName.empty() && fontHandles.memoryData == nullptr)
+    {
+        prewarm(characters, characterSize, bold, outlineThickness);
+        return false;
+    }
+
+    m_impl->pendingPrewarms.push_back(
+        {m_impl->isDistanceField
+             ? std::make_shared<PrewarmJob>(fontHandles, characters, distanceFieldCharacterSize, bold, 0.f, true)
+             : std::make_shared<PrewarmJob>(fontHandles, characters, characterSize, bold, outlineThickness, false),
+         0u});
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isPrewarming() const
+{
+    collectPrewarmedGlyphs();
+    return !m_impl->pendingPrewarms.empty();
 }
 
 
@@ -401,33 +826,45 @@ float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int c
         return 0.f;
 
     FT_Face face = m_impl->fontHandles->face;
+    if (!face)
+        return 0.f;
 
-    if (face && setCurrentSize(characterSize))
-    {
-        // Convert the characters to indices
-        const FT_UInt index1 = FT_Get_Char_Index(face, first);
-        const FT_UInt index2 = FT_Get_Char_Index(face, second);
+    // Convert the characters to indices
+    const unsigned int index1 = getCharIndex(first);
+    const unsigned int index2 = getCharIndex(second);
+
+    // Search the pair into the kerning cache of the character size
+    Impl::KerningTable& kerningTable = m_impl->kerningTables[characterSize];
+    const std::uint64_t key          = (std::uint64_t{index1} << 32) | (std::uint64_t{bold} << 31) | index2;
+
+    if (const float* kerning = kerningTable.find(key))
+        return *kerning;
 
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
-        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
+    // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+    // (first, as loading the glyphs may change the current size)
+    const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
+    const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
 
+    float result = 0.f;
+
+    if (setCurrentSize(characterSize))
+    {
         // Get the kerning vector if present
         FT_Vector kerning{0, 0};
         if (FT_HAS_KERNING(face))
             FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
 
         // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(face))
-            return static_cast<float>(kerning.x);
-
-        // Combine kerning with compensation deltas and return the X advance
+        // Otherwise, combine kerning with compensation deltas to get the X advance
         // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return base::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / float{1 << 6});
+        if (!FT_IS_SCALABLE(face))
+            result = static_cast<float>(kerning.x);
+        else
+            result = base::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / float{1 << 6});
     }
 
-    // Invalid font
-    return 0.f;
+    kerningTable.emplace(key, result);
+    return result;
 }
 
 
@@ -490,7 +927,47 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 const Texture& Font::getTexture(unsigned int characterSize) const
 {
-    return loadPage(*m_impl->graphicsContext, characterSize).texture;
+    // Add the glyphs rasterized in the background since the last call
+    if (!m_impl->pendingPrewarms.empty())
+        collectPrewarmedGlyphs();
+
+    Page& page = m_impl->isDistanceField ? loadDistanceFieldPage() : loadPage(*m_impl->graphicsContext, characterSize);
+
+    // Glyphs looked up from now on are used by the next draw, more recently than the previous ones
+    page.lastUse = ++m_impl->useClock;
+
+    // Distance fields must always be interpolated, regardless of the smooth filter
+    const bool smooth = m_impl->isSmooth || m_impl->isDistanceField;
+
+    // Upload the glyphs loaded since the last call
+    page.atlas->flush(*m_impl->graphicsContext, smooth, m_impl->pixelBuffer, m_impl->statistics);
+
+    return page.atlas->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Font::GlyphStatistics& Font::getGlyphStatistics() const
+{
+    // The state of the cache is measured on demand, only the counters are accumulated
+    m_impl->statistics.pageCount    = m_impl->pages.size() + (m_impl->distanceFieldPage.hasValue() ? 1u : 0u);
+    m_impl->statistics.cachedGlyphs = 0u;
+    m_impl->statistics.textureBytes = getTextureBytes();
+
+    for (const auto& [characterSize, page] : m_impl->pages)
+        m_impl->statistics.cachedGlyphs += page.glyphs.size();
+
+    if (m_impl->distanceFieldPage.hasValue())
+        m_impl->statistics.cachedGlyphs += m_impl->distanceFieldPage->glyphs.size();
+
+    return m_impl->statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::resetGlyphStatistics()
+{
+    m_impl->statistics = {};
 }
 
 ////////////////////////////////////////////////////////////
@@ -502,7 +979,7 @@ void Font::setSmooth(bool smooth)
 
         for (auto& [key, page] : m_impl->pages)
         {
-            page.texture.setSmooth(m_impl->isSmooth);
+            page.atlas->texture.setSmooth(m_impl->isSmooth);
         }
     }
 }
@@ -515,256 +992,563 @@ bool Font::isSmooth() const
 
 
 ////////////////////////////////////////////////////////////
-Font::Page& Font::loadPage(GraphicsContext& graphicsContext, unsigned int characterSize) const
+void Font::setDistanceFieldEnabled(bool enabled)
 {
-    if (const auto it = m_impl->pages.find(characterSize); it != m_impl->pages.end())
-        return it->second;
+    SFML_BASE_ASSERT(m_impl->fontHandles != nullptr);
+
+    if (enabled == m_impl->isDistanceField)
+        return;
+
+    if (enabled)
+    {
+        // Bitmap fonts cannot be rasterized at the reference size, nor scaled without artifacts
+        if (!FT_IS_SCALABLE(m_impl->fontHandles->face))
+        {
+            priv::err() << "Failed to enable distance field glyphs (the font is not scalable)";
+            return;
+        }
+
+        setDistanceFieldSpread(m_impl->fontHandles->library);
+    }
 
-    auto page = Page::create(graphicsContext, m_impl->isSmooth);
-    SFML_BASE_ASSERT(page.hasValue() && "Font::loadPage() Failed to load page");
+    m_impl->isDistanceField = enabled;
 
-    return m_impl->pages.emplace(characterSize, SFML_BASE_MOVE(*page)).first->second;
+    // The compensation deltas of distance field glyphs differ from the hinted ones
+    m_impl->kerningTables.clear();
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+bool Font::isDistanceFieldEnabled() const
 {
-    // The glyph to return
-    Glyph glyph;
-
-    // Get our FT_Face
-    FT_Face face = m_impl->fontHandles->face;
-    if (!face)
-        return glyph;
+    return m_impl->isDistanceField;
+}
 
-    // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
+////////////////////////////////////////////////////////////
+float Font::getDistanceFieldSpread(unsigned int characterSize) const
+{
+    return static_cast<float>(distanceFieldSpread * characterSize) / static_cast<float>(distanceFieldCharacterSize);
+}
 
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
 
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
-    {
-        if (bold)
-        {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
-        }
+////////////////////////////////////////////////////////////
+void Font::setSharedAtlasEnabled(bool enabled)
+{
+    if (enabled == (m_impl->sharedAtlas != nullptr))
+        return;
 
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_impl->fontHandles->stroker;
+    m_impl->sharedAtlas = enabled ? Atlas::create(*m_impl->graphicsContext, m_impl->isSmooth) : nullptr;
 
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
-    }
+    // The glyphs of the existing pages point to their previous atlas
+    clearPages();
+}
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
-    {
-        if (bold)
-            FT_Bitmap_Embolden(m_impl->fontHandles->library, &bitmap, weight, weight);
+////////////////////////////////////////////////////////////
+bool Font::isSharedAtlasEnabled() const
+{
+    return m_impl->sharedAtlas != nullptr;
+}
 
-        if (outlineThickness != 0)
-            priv::err() << "Failed to outline glyph (no fallback available)";
-    }
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+////////////////////////////////////////////////////////////
+void Font::shareAtlasWith(Font& other)
+{
+    other.setSharedAtlasEnabled(true);
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+    if (m_impl->sharedAtlas == other.m_impl->sharedAtlas)
+        return;
+
+    m_impl->sharedAtlas = other.m_impl->sharedAtlas;
+    clearPages();
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setGlyphCacheBudget(std::size_t budget)
+{
+    m_impl->glyphCacheBudget = budget;
+}
 
-    Vector2u size(bitmap.width, bitmap.rows);
 
-    if ((size.x > 0) && (size.y > 0))
+////////////////////////////////////////////////////////////
+std::size_t Font::getGlyphCacheBudget() const
+{
+    return m_impl->glyphCacheBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadPage(GraphicsContext& graphicsContext, unsigned int characterSize) const
+{
+    if (Page* page = m_impl->pages.find(characterSize))
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        page->syncAtlasGeneration();
+        return *page;
+    }
 
-        size += 2u * Vector2u{padding, padding};
+    // With a shared atlas, the pages of the different sizes only differ by their glyph tables
+    std::shared_ptr<Atlas> atlas = m_impl->sharedAtlas != nullptr ? m_impl->sharedAtlas
+                                                                  : Atlas::create(graphicsContext, m_impl->isSmooth);
+    SFML_BASE_ASSERT(atlas != nullptr && "Font::loadPage() Failed to load page");
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(*m_impl->graphicsContext, characterSize);
+    if (m_impl->sharedAtlas == nullptr)
+        m_impl->pageTextureBytes += atlas->pixels.size();
 
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(*m_impl->graphicsContext, page, size);
+    return m_impl->pages.emplace(characterSize, SFML_BASE_MOVE(atlas));
+}
 
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i{padding, padding};
-        glyph.textureRect.size -= 2 * Vector2i{padding, padding};
 
-        // Compute the glyph's bounding box
-        glyph.bounds.position = Vector2i(bitmapGlyph->left, -bitmapGlyph->top).to<Vector2f>();
-        glyph.bounds.size     = Vector2u(bitmap.width, bitmap.rows).to<Vector2f>();
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadDistanceFieldPage() const
+{
+    if (!m_impl->distanceFieldPage.hasValue())
+    {
+        std::shared_ptr<Atlas> atlas = Atlas::create(*m_impl->graphicsContext, /* smooth */ true);
+        SFML_BASE_ASSERT(atlas != nullptr && "Font::loadDistanceFieldPage() Failed to load page");
+
+        m_impl->pageTextureBytes += atlas->pixels.size();
+        m_impl->distanceFieldPage.emplace(SFML_BASE_MOVE(atlas));
+    }
+
+    m_impl->distanceFieldPage->syncAtlasGeneration();
+    return *m_impl->distanceFieldPage;
+}
+
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_impl->pixelBuffer.resize(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4);
+////////////////////////////////////////////////////////////
+const Glyph& Font::getDistanceFieldGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold) const
+{
+    Page&               referencePage = loadDistanceFieldPage();
+    const std::uint64_t key           = combine(0.f, bold, getCharIndex(codePoint));
+
+    // Get the glyphs already scaled to the character size, they are scaled again when their reference glyph moves
+    Page::GlyphTable&  glyphs      = m_impl->distanceFieldGlyphs[characterSize];
+    Page::CachedGlyph* scaledGlyph = glyphs.find(key);
+
+    if (scaledGlyph != nullptr && !referencePage.isStale(*scaledGlyph))
+    {
+        ++m_impl->statistics.cacheHits;
+        return scaledGlyph->glyph;
+    }
+
+    // Not found: find or load the glyph at the reference size
+    Page::GlyphTable&  referenceGlyphs = referencePage.glyphs;
+    Page::CachedGlyph* referenceGlyph  = referenceGlyphs.find(key);
+
+    if (referenceGlyph == nullptr && !m_impl->pendingPrewarms.empty())
+    {
+        collectPrewarmedGlyphs();
+        referenceGlyph = referenceGlyphs.find(key);
+    }
+
+    if (referenceGlyph == nullptr)
+    {
+        ++m_impl->statistics.cacheMisses;
+        const Glyph loadedGlyph = loadGlyph(codePoint, distanceFieldCharacterSize, bold, 0.f);
+        referenceGlyph = &referenceGlyphs.emplace(key, loadedGlyph, m_impl->useClock, referencePage.atlas->generation);
+    }
+    else if (referencePage.isStale(*referenceGlyph))
+    {
+        // Evicted from the atlas by a copy of the font sharing it: load it again at the same address
+        ++m_impl->statistics.cacheMisses;
+        referenceGlyph->glyph           = loadGlyph(codePoint, distanceFieldCharacterSize, bold, 0.f);
+        referenceGlyph->atlasGeneration = referencePage.atlas->generation;
+    }
+    else
+    {
+        ++m_impl->statistics.cacheHits;
+    }
 
-        std::uint8_t* current = m_impl->pixelBuffer.data();
-        std::uint8_t* end     = current + size.x * size.y * 4;
+    // Scale the metrics, the texture rectangle keeps pointing to the reference glyph
+    const float scale = static_cast<float>(characterSize) / static_cast<float>(distanceFieldCharacterSize);
 
-        while (current != end)
+    Glyph glyph = referencePage.use(*referenceGlyph, m_impl->useClock);
+    glyph.advance *= scale;
+    glyph.bounds.position *= scale;
+    glyph.bounds.size *= scale;
+    glyph.lsbDelta = static_cast<int>(static_cast<float>(glyph.lsbDelta) * scale);
+    glyph.rsbDelta = static_cast<int>(static_cast<float>(glyph.rsbDelta) * scale);
+
+    if (scaledGlyph == nullptr)
+        return glyphs.emplace(key, glyph, m_impl->useClock, referencePage.atlas->generation).glyph;
+
+    scaledGlyph->glyph           = glyph;
+    scaledGlyph->atlasGeneration = referencePage.atlas->generation;
+    return scaledGlyph->glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    // Get our FT_Face
+    FT_Face face = m_impl->fontHandles->face;
+    if (!face)
+        return {};
+
+    // Set the character size
+    if (!setCurrentSize(characterSize))
+        return {};
+
+    // Rasterize the glyph, then add it to its page
+    m_impl->rasterizedGlyph.rasterize(m_impl->fontHandles->library,
+                                      face,
+                                      m_impl->fontHandles->stroker,
+                                      codePoint,
+                                      bold,
+                                      outlineThickness,
+                                      m_impl->isDistanceField);
+
+    Page& page = m_impl->isDistanceField ? loadDistanceFieldPage() : loadPage(*m_impl->graphicsContext, characterSize);
+    return insertGlyph(page, m_impl->rasterizedGlyph);
+}
+
+
+////////////////////////////////////////////////////////////
+Glyph Font::insertGlyph(Page& page, const RasterizedGlyph& rasterizedGlyph) const
+{
+    ++m_impl->statistics.rasterizedGlyphs;
+
+    // The glyph to return
+    Glyph glyph = rasterizedGlyph.glyph;
+
+    if ((rasterizedGlyph.size.x == 0) || (rasterizedGlyph.size.y == 0))
+        return glyph;
+
+    // Leave a small padding around characters, so that filtering doesn't
+    // pollute them with pixels from neighbors
+    const auto padding = static_cast<int>(glyphPadding);
+
+    // Find a good position for the new glyph into the texture
+    Atlas& atlas      = *page.atlas;
+    glyph.textureRect = findGlyphRect(*m_impl->graphicsContext,
+                                      atlas,
+                                      rasterizedGlyph.size + 2u * Vector2u{glyphPadding, glyphPadding});
+
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph.textureRect.position += Vector2i{padding, padding};
+    glyph.textureRect.size -= 2 * Vector2i{padding, padding};
+
+    // Write the glyph's pixels to the atlas, they are uploaded to the texture on the next
+    // call to getTexture (the padding around them is still transparent, it was never used)
+    if ((glyph.textureRect.size.x > 0) && (glyph.textureRect.size.y > 0))
+    {
+        const auto          dest  = glyph.textureRect.position.to<Vector2u>();
+        std::uint8_t*       row   = atlas.pixels.data() + dest.x + static_cast<std::size_t>(dest.y) * atlas.size.x;
+        const std::uint8_t* src   = rasterizedGlyph.coverage.data();
+        const unsigned int  width = rasterizedGlyph.size.x;
+
+        for (unsigned int y = 0; y < rasterizedGlyph.size.y; ++y)
         {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
+            std::memcpy(row, src, width);
+
+            row += atlas.size.x;
+            src += width;
         }
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        atlas.markDirty(dest, rasterizedGlyph.size);
+    }
+
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::collectPrewarmedGlyphs() const
+{
+    for (std::size_t i = 0; i < m_impl->pendingPrewarms.size();)
+    {
+        Impl::PendingPrewarm& pending = m_impl->pendingPrewarms[i];
+        PrewarmJob&           job     = *pending.job;
+
+        // Check whether the job is finished before reading its results, so that none is missed
+        const bool finished = job.finished.load(std::memory_order_acquire);
+
         {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < size.y - padding; ++y)
+            const std::lock_guard lock(job.mutex);
+
+            Page& page = job.distanceField ? loadDistanceFieldPage()
+                                           : loadPage(*m_impl->graphicsContext, job.characterSize);
+
+            for (; pending.collectedCount < job.results.size(); ++pending.collectedCount)
             {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
+                const auto& [key, rasterizedGlyph] = job.results[pending.collectedCount];
+
+                // The glyph may have been requested, and loaded, before the worker got to it
+                Page::CachedGlyph* cachedGlyph = page.glyphs.find(key);
+
+                if (cachedGlyph == nullptr)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * size.x;
-                    m_impl->pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8))))
-                                                             ? 255
-                                                             : 0;
+                    const Glyph glyph = insertGlyph(page, rasterizedGlyph);
+                    page.glyphs.emplace(key, glyph, m_impl->useClock, page.atlas->generation);
                 }
-                pixels += bitmap.pitch;
-            }
-        }
-        else
-        {
-            // Pixels are 8 bit gray levels
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
+                else if (page.isStale(*cachedGlyph))
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index            = x + y * size.x;
-                    m_impl->pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                    cachedGlyph->glyph           = insertGlyph(page, rasterizedGlyph);
+                    cachedGlyph->atlasGeneration = page.atlas->generation;
                 }
-                pixels += bitmap.pitch;
             }
         }
 
-        // Write the pixels to the texture
-        const auto dest       = glyph.textureRect.position.to<Vector2u>() - Vector2u{padding, padding};
-        const auto updateSize = glyph.textureRect.size.to<Vector2u>() + 2u * Vector2u{padding, padding};
-        page.texture.update(m_impl->pixelBuffer.data(), updateSize, dest);
+        if (finished)
+            m_impl->pendingPrewarms.erase(m_impl->pendingPrewarms.begin() + static_cast<std::ptrdiff_t>(i));
+        else
+            ++i;
     }
+}
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
 
-    // Done :)
-    return glyph;
+////////////////////////////////////////////////////////////
+IntRect Font::findGlyphRect(GraphicsContext& graphicsContext, Atlas& atlas, Vector2u size) const
+{
+    IntRect rect{{0, 0}, {2, 2}}; // Use a single local variable for NRVO
+
+    while (!atlas.allocate(size, rect))
+    {
+        // Not enough space: resize the atlas if possible (the budget is enforced by compactGlyphCache, as the
+        // glyphs cannot move while the texture coordinates of the previous ones may still be waiting to be drawn)
+        const Vector2u     newSize     = atlas.size * 2u;
+        const unsigned int maximumSize = Texture::getMaximumSize(graphicsContext);
+
+        if ((newSize.x > maximumSize) || (newSize.y > maximumSize))
+        {
+            // Oops, we've reached the maximum texture size...
+            priv::err() << "Failed to add a new character to the font: the maximum texture size has been reached";
+            atlas.isFull = true;
+            return rect;
+        }
+
+        // Make the atlas 2 times bigger, the texture follows on the next flush
+        const std::size_t oldBytes = atlas.pixels.size();
+        atlas.grow(newSize);
+        updateTextureBytes(atlas, oldBytes);
+    }
+
+    return rect;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(GraphicsContext& graphicsContext, Page& page, Vector2u size) const
+void Font::compactGlyphCache()
 {
-    // Find the line that fits well the glyph
-    Page::Row* row       = nullptr;
-    float      bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
+    // Gather the atlases of the font, each shared atlas once
+    std::vector<Atlas*> atlases;
+
+    const auto addAtlas = [&](const Page& page)
     {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
+        if (base::find(atlases.begin(), atlases.end(), page.atlas.get()) == atlases.end())
+            atlases.push_back(page.atlas.get());
+    };
 
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
+    for (const auto& [characterSize, page] : m_impl->pages)
+        addAtlas(page);
 
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
-            continue;
+    if (m_impl->distanceFieldPage.hasValue())
+        addAtlas(*m_impl->distanceFieldPage);
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
+    // Make room in the atlases that could not grow anymore, by keeping the most recently used half of their glyphs
+    for (Atlas* atlas : atlases)
+        if (atlas->isFull)
+            compactAtlas(*atlas, atlas->pixels.size() / 2);
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
+    const std::size_t budget = m_impl->glyphCacheBudget;
+
+    if ((budget == 0) || (getTextureBytes() <= budget))
+        return;
+
+    // Atlases never shrink below their initial size, evicting glyphs that fit in half of it wouldn't save memory
+    const std::size_t minimumBytes = std::size_t{initialAtlasSize} * initialAtlasSize / 2u;
+
+    // Shrink the atlases of the least recently used character sizes first (unless all the sizes share one),
+    // the most recently used one is compacted with the other atlases
+    if (m_impl->sharedAtlas == nullptr)
+    {
+        std::vector<Page*> pages;
+
+        for (auto& [characterSize, page] : m_impl->pages)
+            pages.push_back(&page);
+
+        std::sort(pages.begin(),
+                  pages.end(),
+                  [](const Page* lhs, const Page* rhs) { return lhs->lastUse < rhs->lastUse; });
+
+        for (std::size_t i = 0; (i + 1 < pages.size()) && (getTextureBytes() > budget); ++i)
+            compactAtlas(*pages[i]->atlas, minimumBytes);
     }
 
-    IntRect rect{{0, 0}, {2, 2}}; // Use a single local variable for NRVO
+    // Then keep the most recently used glyphs of each atlas, in half of what's left of the budget
+    for (Atlas* atlas : atlases)
+    {
+        if (getTextureBytes() <= budget)
+            break;
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+        const std::size_t otherBytes = getTextureBytes() - atlas->pixels.size();
+        compactAtlas(*atlas, base::max(budget > otherBytes ? (budget - otherBytes) / 2 : 0u, minimumBytes));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::compactAtlas(Atlas& atlas, std::size_t targetBytes) const
+{
+    struct Resident
     {
-        const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
+        Page*              page;        //!< Page whose glyph table holds the glyph
+        std::uint64_t      key;         //!< Key of the glyph in the table
+        Page::CachedGlyph* cachedGlyph; //!< Glyph stored in the atlas
+    };
+
+    // Gather the glyphs stored in the atlas by this font (other fonts load theirs again on their next use)
+    std::vector<Page*>    atlasPages;
+    std::vector<Resident> residents;
+    std::vector<Resident> unpacked;
+
+    const auto gather = [&](Page& page)
+    {
+        if (page.atlas.get() != &atlas)
+            return;
+
+        atlasPages.push_back(&page);
+
+        // Stale glyphs were already evicted by another font sharing the atlas, their area is not in use anymore
+        for (const auto& [key, cachedGlyph] : page.glyphs)
         {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize(graphicsContext)) &&
-                (textureSize.y * 2 <= Texture::getMaximumSize(graphicsContext)))
-            {
-                // Make the texture 2 times bigger
-                auto newTexture = sf::Texture::create(graphicsContext, textureSize * 2u);
-                if (!newTexture.hasValue())
-                {
-                    priv::err() << "Failed to create new page texture";
-                    return rect;
-                }
+            if (page.isStale(*cachedGlyph))
+                continue;
 
-                newTexture->setSmooth(m_impl->isSmooth);
-                newTexture->update(page.texture);
-                page.texture.swap(*newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
-                priv::err() << "Failed to add a new character to the font: the maximum texture size has been reached";
-                return rect;
-            }
+            const Glyph& glyph = cachedGlyph->glyph;
+
+            if ((glyph.textureRect.size.x > 0) && (glyph.textureRect.size.y > 0))
+                residents.push_back({&page, key, cachedGlyph});
+            else if ((glyph.bounds.size.x > 0.f) && (glyph.bounds.size.y > 0.f))
+                unpacked.push_back({&page, key, cachedGlyph}); // Didn't fit in the full atlas, try again after
         }
+    };
+
+    for (auto& [characterSize, page] : m_impl->pages)
+        gather(page);
+
+    if (m_impl->distanceFieldPage.hasValue())
+        gather(*m_impl->distanceFieldPage);
+
+    // Most recently used glyphs first
+    std::sort(residents.begin(),
+              residents.end(),
+              [](const Resident& lhs, const Resident& rhs)
+              { return lhs.cachedGlyph->lastUse > rhs.cachedGlyph->lastUse; });
+
+    const Vector2u padding{glyphPadding, glyphPadding};
+
+    // Keep the most recently used glyphs up to the target size
+    std::size_t keptCount = 0;
+    std::size_t keptBytes = 0;
+
+    for (; keptCount < residents.size(); ++keptCount)
+    {
+        const Page::CachedGlyph& cachedGlyph = *residents[keptCount].cachedGlyph;
+
+        const Vector2u    areaSize = cachedGlyph.glyph.textureRect.size.to<Vector2u>() + 2u * padding;
+        const std::size_t bytes    = static_cast<std::size_t>(areaSize.x) * areaSize.y;
+
+        if (keptBytes + bytes > targetBytes)
+            break;
 
-        // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
+        keptBytes += bytes;
     }
 
-    // Find the glyph's rectangle on the selected row
-    rect.position.x = static_cast<int>(row->width);
-    rect.position.y = static_cast<int>(row->top);
-    rect.size.x     = static_cast<int>(size.x);
-    rect.size.y     = static_cast<int>(size.y);
+    // Shrink the atlas if the kept glyphs fit in a smaller one, leaving as much room for new glyphs
+    Vector2u newSize{initialAtlasSize, initialAtlasSize};
+    while ((newSize.x < atlas.size.x) && (static_cast<std::size_t>(newSize.x) * newSize.y < keptBytes * 2u))
+        newSize *= 2u;
 
-    // Update the row information
-    row->width += size.x;
+    // Nothing to evict nor to shrink: repacking would only move the glyphs around
+    if ((keptCount == residents.size()) && unpacked.empty() && (newSize == atlas.size))
+        return;
 
-    return rect;
+    // Pack the kept glyphs again, most recently used first, copying their pixels from the previous layout
+    std::vector<std::uint8_t> oldPixels;
+    oldPixels.swap(atlas.pixels);
+    const unsigned int oldWidth = atlas.size.x;
+
+    atlas.reset(newSize);
+    updateTextureBytes(atlas, oldPixels.size());
+
+    std::size_t packedCount = 0;
+
+    for (; packedCount < keptCount; ++packedCount)
+    {
+        Glyph&         glyph     = residents[packedCount].cachedGlyph->glyph;
+        const Vector2u glyphSize = glyph.textureRect.size.to<Vector2u>();
+
+        // If the kept glyphs don't all fit after all, the least recently used ones are evicted too
+        IntRect rect;
+        if (!atlas.allocate(glyphSize + 2u * padding, rect))
+            break;
+
+        const Vector2u source = glyph.textureRect.position.to<Vector2u>();
+        const Vector2u dest   = rect.position.to<Vector2u>() + padding;
+
+        for (unsigned int y = 0; y < glyphSize.y; ++y)
+            std::memcpy(atlas.pixels.data() + dest.x + static_cast<std::size_t>(dest.y + y) * atlas.size.x,
+                        oldPixels.data() + source.x + static_cast<std::size_t>(source.y + y) * oldWidth,
+                        glyphSize.x);
+
+        glyph.textureRect.position = dest.to<Vector2i>();
+    }
+
+    // Evict the other glyphs, the remaining ones keep their address
+    for (std::size_t i = packedCount; i < residents.size(); ++i)
+        residents[i].page->glyphs.erase(residents[i].key);
+
+    // The glyphs which didn't fit in the atlas when it was full are loaded again on their next use
+    for (const Resident& resident : unpacked)
+        resident.page->glyphs.erase(resident.key);
+
+    m_impl->statistics.evictedGlyphs += residents.size() - packedCount + unpacked.size();
+    ++m_impl->statistics.compactions;
+
+    // The glyphs of other fonts, and the scaled distance field glyphs, refer to the previous layout
+    ++atlas.generation;
+
+    for (std::size_t i = 0; i < packedCount; ++i)
+        residents[i].cachedGlyph->atlasGeneration = atlas.generation;
+
+    // The ASCII tables may point to evicted glyphs
+    for (Page* page : atlasPages)
+    {
+        page->asciiGlyphs.clear();
+        page->atlasGeneration = atlas.generation;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::getTextureBytes() const
+{
+    // The shared atlas can also be grown by the other fonts using it, read its size directly
+    return m_impl->pageTextureBytes + (m_impl->sharedAtlas != nullptr ? m_impl->sharedAtlas->pixels.size() : 0u);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::updateTextureBytes(const Atlas& atlas, std::size_t oldBytes) const
+{
+    if (&atlas != m_impl->sharedAtlas.get())
+        m_impl->pageTextureBytes = m_impl->pageTextureBytes - oldBytes + atlas.pixels.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::clearPages()
+{
+    m_impl->pages.clear();
+
+    // Only the distance field page is left
+    m_impl->pageTextureBytes = m_impl->distanceFieldPage.hasValue() ? m_impl->distanceFieldPage->atlas->pixels.size()
+                                                                    : 0u;
 }
 
 
@@ -810,32 +1594,371 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Font::Page> Font::Page::create(GraphicsContext& graphicsContext, bool smooth)
+std::shared_ptr<Font::Atlas> Font::Atlas::create(GraphicsContext& graphicsContext, bool smooth)
 {
+    // Glyphs only need their coverage, store it in a single-channel texture
+    auto texture = sf::Texture::createSingleChannel(graphicsContext, {initialAtlasSize, initialAtlasSize});
+    if (!texture.hasValue())
+    {
+        priv::err() << "Failed to load font page texture";
+        return nullptr;
+    }
+
     // Make sure that the texture is initialized by default
-    auto image = *Image::create({128, 128}, Color::Transparent);
+    std::vector<std::uint8_t> pixels(initialAtlasSize * initialAtlasSize, 0);
 
     // Reserve a 2x2 white square for texturing underlines
     for (unsigned int x = 0; x < 2; ++x)
         for (unsigned int y = 0; y < 2; ++y)
-            image.setPixel({x, y}, Color::White);
+            pixels[x + y * initialAtlasSize] = 255;
 
-    // Create the texture
-    auto texture = sf::Texture::loadFromImage(graphicsContext, image);
-    if (!texture.hasValue())
+    texture->update(pixels.data());
+    texture->setSmooth(smooth);
+    return std::make_shared<Atlas>(SFML_BASE_MOVE(*texture), SFML_BASE_MOVE(pixels));
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Atlas::Atlas(Texture&& theTexture, std::vector<std::uint8_t>&& thePixels) :
+texture(SFML_BASE_MOVE(theTexture)),
+pixels(SFML_BASE_MOVE(thePixels)),
+size(texture.getSize()),
+dirtyBegin(size)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::Atlas::allocate(Vector2u areaSize, IntRect& rect)
+{
+    // Find the line that fits well the glyph
+    Row*  row       = nullptr;
+    float bestRatio = 0;
+    for (auto it = rows.begin(); it != rows.end() && !row; ++it)
     {
-        priv::err() << "Failed to load font page texture";
-        return base::nullOpt;
+        const float ratio = static_cast<float>(areaSize.y) / static_cast<float>(it->height);
+
+        // Ignore rows that are either too small or too high
+        if ((ratio < 0.7f) || (ratio > 1.f))
+            continue;
+
+        // Check if there's enough horizontal space left in the row
+        if (areaSize.x > size.x - it->width)
+            continue;
+
+        // Make sure that this new row is the best found so far
+        if (ratio < bestRatio)
+            continue;
+
+        // The current row passed all the tests: we can select it
+        row       = &*it;
+        bestRatio = ratio;
     }
 
-    texture->setSmooth(smooth);
-    return base::makeOptional<Page>(SFML_BASE_MOVE(*texture));
+    // If we didn't find a matching row, create a new one (10% taller than the glyph)
+    if (!row)
+    {
+        const unsigned int rowHeight = areaSize.y + areaSize.y / 10;
+
+        // Not enough space left below the existing rows
+        if ((nextRow + rowHeight >= size.y) || (areaSize.x >= size.x))
+            return false;
+
+        rows.emplace_back(nextRow, rowHeight);
+        nextRow += rowHeight;
+        row = &rows.back();
+    }
+
+    // Find the glyph's rectangle on the selected row
+    rect.position.x = static_cast<int>(row->width);
+    rect.position.y = static_cast<int>(row->top);
+    rect.size.x     = static_cast<int>(areaSize.x);
+    rect.size.y     = static_cast<int>(areaSize.y);
+
+    // Update the row information
+    row->width += areaSize.x;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::grow(Vector2u newSize)
+{
+    std::vector<std::uint8_t> newPixels(static_cast<std::size_t>(newSize.x) * newSize.y, 0);
+
+    for (unsigned int y = 0; y < size.y; ++y)
+        std::memcpy(newPixels.data() + static_cast<std::size_t>(y) * newSize.x,
+                    pixels.data() + static_cast<std::size_t>(y) * size.x,
+                    size.x);
+
+    pixels.swap(newPixels);
+    size = newSize;
+
+    // The whole texture is recreated on the next flush, no need to track the modified area anymore
+    dirtyBegin      = size;
+    dirtyEnd        = {0, 0};
+    recreateTexture = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::reset(Vector2u newSize)
+{
+    // Make sure that the texture is initialized by default
+    pixels.assign(static_cast<std::size_t>(newSize.x) * newSize.y, 0);
+    size = newSize;
+
+    // Reserve a 2x2 white square for texturing underlines
+    for (unsigned int x = 0; x < 2; ++x)
+        for (unsigned int y = 0; y < 2; ++y)
+            pixels[x + y * size.x] = 255;
+
+    rows.clear();
+    nextRow = 3;
+    isFull  = false;
+
+    // The whole texture is recreated on the next flush, no need to track the modified area anymore
+    dirtyBegin      = size;
+    dirtyEnd        = {0, 0};
+    recreateTexture = true;
 }
 
 
 ////////////////////////////////////////////////////////////
-Font::Page::Page(Texture&& theTexture) : texture(SFML_BASE_MOVE(theTexture))
+void Font::Atlas::markDirty(Vector2u position, Vector2u areaSize)
 {
+    dirtyBegin = {base::min(dirtyBegin.x, position.x), base::min(dirtyBegin.y, position.y)};
+    dirtyEnd   = {base::max(dirtyEnd.x, position.x + areaSize.x), base::max(dirtyEnd.y, position.y + areaSize.y)};
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Atlas::flush(GraphicsContext&           graphicsContext,
+                        bool                       smooth,
+                        std::vector<std::uint8_t>& stagingBuffer,
+                        GlyphStatistics&           statistics)
+{
+    if (recreateTexture)
+    {
+        // The page grew or was repacked since the last flush: upload it entirely to a new texture
+        auto newTexture = sf::Texture::createSingleChannel(graphicsContext, size);
+        if (!newTexture.hasValue())
+        {
+            priv::err() << "Failed to create new page texture";
+            return;
+        }
+
+        newTexture->setSmooth(smooth);
+        newTexture->update(pixels.data());
+        texture.swap(*newTexture);
+        recreateTexture = false;
+
+        statistics.uploadedBytes += pixels.size();
+        ++statistics.textureUploads;
+    }
+    else if ((dirtyBegin.x < dirtyEnd.x) && (dirtyBegin.y < dirtyEnd.y))
+    {
+        // Upload the bounding box of all the glyphs loaded since the last flush at once
+        const Vector2u    dirtySize = dirtyEnd - dirtyBegin;
+        const std::size_t byteCount = static_cast<std::size_t>(dirtySize.x) * dirtySize.y;
+
+        const std::uint8_t* rows = pixels.data() + dirtyBegin.x + static_cast<std::size_t>(dirtyBegin.y) * size.x;
+
+        if (dirtySize.x != size.x)
+        {
+            // Rows of the area aren't contiguous in the page, gather them first
+            stagingBuffer.resize(byteCount);
+
+            for (unsigned int y = 0; y < dirtySize.y; ++y)
+                std::memcpy(stagingBuffer.data() + static_cast<std::size_t>(y) * dirtySize.x,
+                            rows + static_cast<std::size_t>(y) * size.x,
+                            dirtySize.x);
+
+            rows = stagingBuffer.data();
+        }
+
+        texture.update(rows, dirtySize, dirtyBegin);
+
+        statistics.uploadedBytes += byteCount;
+        ++statistics.textureUploads;
+    }
+
+    dirtyBegin = size;
+    dirtyEnd   = {0, 0};
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::RasterizedGlyph::rasterize(FT_Library    library,
+                                      FT_Face       face,
+                                      FT_Stroker    stroker,
+                                      std::uint32_t codePoint,
+                                      bool          bold,
+                                      float         outlineThickness,
+                                      bool          distanceField)
+{
+    glyph = Glyph{};
+    size  = {0, 0};
+
+    // Load the glyph corresponding to the code point
+    // Distance field glyphs are scaled to all sizes, hinting them for the reference size would distort them
+    FT_Int32 flags = distanceField ? (FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP)
+                                   : (FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT);
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Char(face, codePoint, flags) != 0)
+        return;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Glyph_To_Bitmap(&glyphDesc, distanceField ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        if (outlineThickness != 0)
+            priv::err() << "Failed to outline glyph (no fallback available)";
+    }
+
+    // Compute the glyph's advance offset (unrounded for distance field glyphs, which are scaled afterwards)
+    glyph.advance = distanceField ? static_cast<float>(bitmapGlyph->root.advance.x) / float{1 << 16}
+                                  : static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    if ((bitmap.width > 0) && (bitmap.rows > 0))
+    {
+        size = {bitmap.width, bitmap.rows};
+
+        // Compute the glyph's bounding box
+        glyph.bounds.position = Vector2i(bitmapGlyph->left, -bitmapGlyph->top).to<Vector2f>();
+        glyph.bounds.size     = size.to<Vector2f>();
+
+        // Extract the glyph's pixels from the bitmap, one coverage byte per pixel
+        coverage.resize(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y));
+
+        std::uint8_t*       current = coverage.data();
+        const std::uint8_t* pixels  = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                for (unsigned int x = 0; x < size.x; ++x)
+                    *current++ = (pixels[x / 8] & (1 << (7 - (x % 8)))) ? 255 : 0;
+
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bit gray levels, copy them row by row
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                std::memcpy(current, pixels, size.x);
+
+                current += size.x;
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::PrewarmJob::run(const std::string&  fileName,
+                           const void*         memoryData,
+                           std::size_t         memorySize,
+                           std::u32string_view codePoints,
+                           bool                bold,
+                           float               outlineThickness)
+{
+    // Open a face of our own, FreeType faces cannot be shared between threads
+    FT_Library library = nullptr;
+    FT_Face    face    = nullptr;
+    FT_Stroker stroker = nullptr;
+
+    bool opened = (FT_Init_FreeType(&library) == 0);
+
+    if (opened && (memoryData != nullptr))
+        opened = (FT_New_Memory_Face(library,
+                                     static_cast<const FT_Byte*>(memoryData),
+                                     static_cast<FT_Long>(memorySize),
+                                     0,
+                                     &face) == 0);
+    else if (opened)
+        opened = (FT_New_Face(library, fileName.c_str(), 0, &face) == 0);
+
+    opened = opened && (FT_Stroker_New(library, &stroker) == 0) && (FT_Select_Charmap(face, FT_ENCODING_UNICODE) == 0) &&
+             (FT_Set_Pixel_Sizes(face, 0, characterSize) == 0);
+
+    if (opened && distanceField)
+        setDistanceFieldSpread(library);
+
+    // On failure, no glyph is produced and they are all loaded on demand as usual
+    if (opened)
+    {
+        for (const char32_t codePoint : codePoints)
+        {
+            if (cancelled.load(std::memory_order_relaxed))
+                break;
+
+            RasterizedGlyph rasterizedGlyph;
+            rasterizedGlyph.rasterize(library, face, stroker, codePoint, bold, outlineThickness, distanceField);
+
+            const std::uint64_t key = combine(outlineThickness, bold, FT_Get_Char_Index(face, codePoint));
+
+            const std::lock_guard lock(mutex);
+            results.emplace_back(key, SFML_BASE_MOVE(rasterizedGlyph));
+        }
+    }
+
+    // All the functions below are safe to call with null pointer arguments
+    FT_Stroker_Done(stroker);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+
+    finished.store(true, std::memory_order_release);
 }
 
 } // namespace sf
@@ -16,8 +16,10 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 void copyMatrix(const Transform& source, Matrix<3, 3>& dest)
 {
-    const float* from = source.getMatrix(); // 4x4
-    float*       to   = dest.array;         // 3x3
+    float from[16]; // 4x4
+    source.getMatrix(from);
+
+    float* to = dest.array; // 3x3
 
     // Use only left-upper 3x3 block (for a 2D transform)
     to[0] = from[0];
@@ -35,8 +37,8 @@ void copyMatrix(const Transform& source, Matrix<3, 3>& dest)
 ////////////////////////////////////////////////////////////
 void copyMatrix(const Transform& source, Matrix<4, 4>& dest)
 {
-    // Adopt 4x4 matrix as-is
-    copyMatrix(source.getMatrix(), 4 * 4, dest.array);
+    // Expand the 3x2 affine matrix to a full 4x4 matrix
+    source.getMatrix(dest.array);
 }
 
 } // namespace sf::priv
@@ -3,6 +3,8 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Glsl.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
 #include "SFML/Graphics/Shader.hpp"
@@ -18,11 +20,24 @@
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Optional.hpp"
 
+#include <atomic>
+
+#include <cstddef>
 #include <cstdlib>
 
 
 namespace
 {
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxGlContextIdCount{256ul};
+
+
+////////////////////////////////////////////////////////////
+// Shader program bound to each OpenGL context, indexed by context id.
+// Fresh contexts have no program bound, which matches a zeroed entry.
+constinit std::atomic<unsigned int> glContextBoundPrograms[maxGlContextIdCount]{};
+
+
 ////////////////////////////////////////////////////////////
 constexpr const char* builtInShaderVertexSrc = R"glsl(#version 300 es
 
@@ -30,8 +45,11 @@ constexpr const char* builtInShaderVertexSrc = R"glsl(#version 300 es
 precision mediump float;
 #endif
 
-uniform mat4 sf_u_modelViewProjectionMatrix;
-uniform mat4 sf_u_textureMatrix;
+layout(std140) uniform sf_u_BuiltInMatrices
+{
+    mat4 sf_u_modelViewProjectionMatrix;
+    mat4 sf_u_textureMatrix;
+};
 
 in vec2 sf_a_position;
 in vec4 sf_a_color;
@@ -50,6 +68,44 @@ void main()
 )glsl";
 
 
+////////////////////////////////////////////////////////////
+constexpr const char* builtInInstancedShaderVertexSrc = R"glsl(#version 300 es
+
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+layout(std140) uniform sf_u_BuiltInMatrices
+{
+    mat4 sf_u_modelViewProjectionMatrix;
+    mat4 sf_u_textureMatrix;
+};
+
+in vec3 sf_a_instanceTransformX;
+in vec3 sf_a_instanceTransformY;
+in vec4 sf_a_instanceTextureRect;
+in vec4 sf_a_instanceColor;
+
+out vec4 sf_v_color;
+out vec2 sf_v_texCoord;
+
+void main()
+{
+    // Expand the quad corner from the vertex index, in triangle strip order
+    vec2 corner = vec2(float(gl_VertexID >> 1), float(gl_VertexID & 1));
+    vec3 localPosition = vec3(corner * abs(sf_a_instanceTextureRect.zw), 1.0);
+
+    vec2 position = vec2(dot(sf_a_instanceTransformX, localPosition), dot(sf_a_instanceTransformY, localPosition));
+    vec2 texCoord = sf_a_instanceTextureRect.xy + corner * sf_a_instanceTextureRect.zw;
+
+    gl_Position = sf_u_modelViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    sf_v_color = sf_a_instanceColor;
+    sf_v_texCoord = (sf_u_textureMatrix * vec4(texCoord, 0.0, 1.0)).xy;
+}
+
+)glsl";
+
+
 ////////////////////////////////////////////////////////////
 constexpr const char* builtInShaderFragmentSrc = R"glsl(#version 300 es
 
@@ -72,6 +128,49 @@ void main()
 )glsl";
 
 
+////////////////////////////////////////////////////////////
+// Draws signed distance field glyphs (stored in the alpha channel), filled with the
+// vertex color and surrounded by an outline of the uniform color and thickness
+constexpr const char* builtInDistanceFieldShaderFragmentSrc = R"glsl(#version 300 es
+
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+uniform sampler2D sf_u_texture;
+uniform float sf_u_outlineThickness;
+uniform vec4 sf_u_outlineColor;
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+out vec4 sf_fragColor;
+
+void main()
+{
+    float distance = texture(sf_u_texture, sf_v_texCoord.st).a;
+
+    // Antialias over one screen pixel, whatever the scale of the glyph
+    float smoothing = max(fwidth(distance), 0.0001);
+
+    float fillEdge    = 0.5;
+    float outlineEdge = 0.5 - sf_u_outlineThickness;
+
+    float fillAlpha    = sf_v_color.a * clamp((distance - fillEdge) / smoothing + 0.5, 0.0, 1.0);
+    float outlineAlpha = sf_u_outlineColor.a * clamp((distance - outlineEdge) / smoothing + 0.5, 0.0, 1.0);
+
+    // Blend the fill over the outline
+    float alpha = fillAlpha + outlineAlpha * (1.0 - fillAlpha);
+    if (alpha <= 0.0)
+        discard;
+
+    vec3 color = (sf_v_color.rgb * fillAlpha + sf_u_outlineColor.rgb * outlineAlpha * (1.0 - fillAlpha)) / alpha;
+    sf_fragColor = vec4(color, alpha);
+}
+
+)glsl";
+
+
 ////////////////////////////////////////////////////////////
 [[nodiscard]] sf::Shader createBuiltInShader(sf::GraphicsContext& graphicsContext, const char* vertexSrc, const char* fragmentSrc)
 {
@@ -93,7 +192,12 @@ namespace sf
 struct GraphicsContext::Impl
 {
     base::Optional<Shader>  builtInShader;
+    base::Optional<Shader>  builtInInstancedShader;
+    base::Optional<Shader>  builtInDistanceFieldShader;
     base::Optional<Texture> builtInWhiteDotTexture;
+
+    float distanceFieldOutlineThickness{};               //!< Outline thickness last set on the distance field shader
+    Color distanceFieldOutlineColor{Color::Transparent}; //!< Outline color last set on the distance field shader
 };
 
 
@@ -114,7 +218,21 @@ GraphicsContext::GraphicsContext()
     }
 #endif
 
+    // Context ids are reused by each graphics context, forget the bindings of the previous one
+    for (std::atomic<unsigned int>& boundProgram : glContextBoundPrograms)
+        boundProgram.store(0u, std::memory_order_relaxed);
+
     m_impl->builtInShader.emplace(createBuiltInShader(*this, builtInShaderVertexSrc, builtInShaderFragmentSrc));
+    m_impl->builtInInstancedShader.emplace(
+        createBuiltInShader(*this, builtInInstancedShaderVertexSrc, builtInShaderFragmentSrc));
+    m_impl->builtInDistanceFieldShader.emplace(
+        createBuiltInShader(*this, builtInShaderVertexSrc, builtInDistanceFieldShaderFragmentSrc));
+
+    // Start without outline, the uniforms are only updated when the outline changes
+    Shader& distanceFieldShader = *m_impl->builtInDistanceFieldShader;
+    if (const base::Optional ulOutlineColor = distanceFieldShader.getUniformLocation("sf_u_outlineColor"))
+        distanceFieldShader.setUniform(*ulOutlineColor, Glsl::Vec4{Color::Transparent});
+
     m_impl->builtInWhiteDotTexture = Texture::loadFromImage(*this, *Image::create({1u, 1u}, Color::White));
 }
 
@@ -135,6 +253,20 @@ GraphicsContext::~GraphicsContext()
 }
 
 
+////////////////////////////////////////////////////////////
+[[nodiscard]] Shader& GraphicsContext::getBuiltInInstancedShader()
+{
+    return *m_impl->builtInInstancedShader;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] Shader& GraphicsContext::getBuiltInDistanceFieldShader()
+{
+    return *m_impl->builtInDistanceFieldShader;
+}
+
+
 ////////////////////////////////////////////////////////////
 [[nodiscard]] Texture& GraphicsContext::getBuiltInWhiteDotTexture()
 {
@@ -142,6 +274,45 @@ GraphicsContext::~GraphicsContext()
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int GraphicsContext::getActiveThreadLocalGlContextProgram() const
+{
+    const std::uint64_t glContextId = getActiveThreadLocalGlContextId();
+    SFML_BASE_ASSERT(glContextId < maxGlContextIdCount);
+
+    return glContextBoundPrograms[glContextId].load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void GraphicsContext::setActiveThreadLocalGlContextProgram(unsigned int program)
+{
+    const std::uint64_t glContextId = getActiveThreadLocalGlContextId();
+    SFML_BASE_ASSERT(glContextId < maxGlContextIdCount);
+
+    glContextBoundPrograms[glContextId].store(program, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void GraphicsContext::setBuiltInDistanceFieldOutline(float thickness, Color color)
+{
+    if (thickness == m_impl->distanceFieldOutlineThickness && color == m_impl->distanceFieldOutlineColor)
+        return;
+
+    Shader& shader = *m_impl->builtInDistanceFieldShader;
+
+    if (const base::Optional ulOutlineThickness = shader.getUniformLocation("sf_u_outlineThickness"))
+        shader.setUniform(*ulOutlineThickness, thickness);
+
+    if (const base::Optional ulOutlineColor = shader.getUniformLocation("sf_u_outlineColor"))
+        shader.setUniform(*ulOutlineColor, Glsl::Vec4{color});
+
+    m_impl->distanceFieldOutlineThickness = thickness;
+    m_impl->distanceFieldOutlineColor     = color;
+}
+
+
 ////////////////////////////////////////////////////////////
 const char* GraphicsContext::getBuiltInShaderVertexSrc() const
 {
@@ -13,6 +13,7 @@
 
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
 #include "SFML/Base/UniquePtr.hpp"
@@ -426,6 +427,14 @@ const std::uint8_t* Image::getPixelsPtr() const
 }
 
 
+////////////////////////////////////////////////////////////
+std::uint8_t* Image::getMutablePixelsPtr()
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    return m_impl->pixels.data();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Image::flipHorizontally()
 {
@@ -468,4 +477,60 @@ void Image::flipVertically()
     }
 }
 
+
+////////////////////////////////////////////////////////////
+Image Image::createDownsampled() const
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
+
+    const Vector2u srcSize = m_impl->size;
+    const Vector2u dstSize{base::max(srcSize.x / 2u, 1u), base::max(srcSize.y / 2u, 1u)};
+
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(dstSize.x) * dstSize.y * 4u);
+
+    const std::uint8_t* src = m_impl->pixels.data();
+    std::uint8_t*       dst = pixels.data();
+
+    for (unsigned int y = 0; y < dstSize.y; ++y)
+    {
+        // Sizes of 1 are not halved, the same source row (or column) is then used twice
+        const std::size_t row0 = static_cast<std::size_t>(2u * y) * srcSize.x;
+        const std::size_t row1 = static_cast<std::size_t>(base::min(2u * y + 1u, srcSize.y - 1u)) * srcSize.x;
+
+        for (unsigned int x = 0; x < dstSize.x; ++x)
+        {
+            const unsigned int col0 = 2u * x;
+            const unsigned int col1 = base::min(2u * x + 1u, srcSize.x - 1u);
+
+            const std::uint8_t* const block[]{src + (row0 + col0) * 4u,
+                                              src + (row0 + col1) * 4u,
+                                              src + (row1 + col0) * 4u,
+                                              src + (row1 + col1) * 4u};
+
+            unsigned int alphaSum = 0u;
+            unsigned int colorSums[3]{};
+
+            for (const std::uint8_t* pixel : block)
+            {
+                alphaSum += pixel[3];
+
+                for (unsigned int c = 0u; c < 3u; ++c)
+                    colorSums[c] += pixel[c] * pixel[3];
+            }
+
+            // Fully transparent blocks keep the plain average of their colors
+            for (unsigned int c = 0u; c < 3u; ++c)
+            {
+                const unsigned int plainSum = block[0][c] + block[1][c] + block[2][c] + block[3][c];
+                *dst++ = static_cast<std::uint8_t>(alphaSum == 0u ? (plainSum + 2u) / 4u
+                                                                   : (colorSums[c] + alphaSum / 2u) / alphaSum);
+            }
+
+            *dst++ = static_cast<std::uint8_t>((alphaSum + 2u) / 4u);
+        }
+    }
+
+    return Image(base::PassKey<Image>{}, dstSize, SFML_BASE_MOVE(pixels));
+}
+
 } // namespace sf
@@ -0,0 +1,256 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/IndexBuffer.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include <utility>
+
+#include <cstddef>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace IndexBufferImpl
+{
+GLenum usageToGlEnum(sf::IndexBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::IndexBuffer::Usage::Static:
+            return GL_STATIC_DRAW;
+        case sf::IndexBuffer::Usage::Dynamic:
+            return GL_DYNAMIC_DRAW;
+        default:
+            return GL_STREAM_DRAW;
+    }
+}
+} // namespace IndexBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(GraphicsContext& graphicsContext) : m_graphicsContext(&graphicsContext)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(GraphicsContext& graphicsContext, Usage usage) :
+m_graphicsContext(&graphicsContext),
+m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(const IndexBuffer& rhs) : m_graphicsContext(rhs.m_graphicsContext), m_usage(rhs.m_usage)
+{
+    if (rhs.m_buffer && rhs.m_size)
+    {
+        if (!create(rhs.m_size))
+        {
+            priv::err() << "Could not create index buffer for copying";
+            return;
+        }
+
+        if (!update(rhs))
+            priv::err() << "Could not copy index buffer";
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::~IndexBuffer()
+{
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+        glCheck(glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::create(std::size_t indexCount)
+{
+    if (!VertexBuffer::isAvailable(*m_graphicsContext))
+        return false;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    if (!m_buffer)
+        glCheck(glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        priv::err() << "Could not create index buffer, generation failed";
+        return false;
+    }
+
+    // Use the generic copy-write target, binding an element array buffer would modify the current VAO
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+    glCheck(glBufferData(GL_COPY_WRITE_BUFFER,
+                         static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount),
+                         nullptr,
+                         IndexBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+
+    m_size = indexCount;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IndexBuffer::getIndexCount() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const IndexType* indices)
+{
+    return update(indices, m_size, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const IndexType* indices, std::size_t indexCount, unsigned int offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!indices)
+        return false;
+
+    if (offset && (offset + indexCount > m_size))
+        return false;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+
+    // Check if we need to resize or orphan the buffer
+    if (indexCount >= m_size)
+    {
+        glCheck(glBufferData(GL_COPY_WRITE_BUFFER,
+                             static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount),
+                             nullptr,
+                             IndexBufferImpl::usageToGlEnum(m_usage)));
+
+        m_size = indexCount;
+    }
+
+    glCheck(glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(sizeof(IndexType) * offset),
+                            static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount),
+                            indices));
+
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const IndexBuffer& indexBuffer)
+{
+    if (!m_buffer || !indexBuffer.m_buffer)
+        return false;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    if (!GLEXT_copy_buffer)
+    {
+        priv::err() << "Could not copy index buffer, buffer copies are not supported";
+        return false;
+    }
+
+    glCheck(glBindBuffer(GL_COPY_READ_BUFFER, indexBuffer.m_buffer));
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+
+    glCheck(glCopyBufferSubData(GL_COPY_READ_BUFFER,
+                                GL_COPY_WRITE_BUFFER,
+                                0,
+                                0,
+                                static_cast<GLsizeiptr>(sizeof(IndexType) * indexBuffer.m_size)));
+
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+    glCheck(glBindBuffer(GL_COPY_READ_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer& IndexBuffer::operator=(const IndexBuffer& rhs)
+{
+    IndexBuffer temp(rhs);
+
+    swap(temp);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::swap(IndexBuffer& right) noexcept
+{
+    std::swap(m_size, right.m_size);
+    std::swap(m_buffer, right.m_buffer);
+    std::swap(m_usage, right.m_usage);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int IndexBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::Usage IndexBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::bind([[maybe_unused]] GraphicsContext& graphicsContext, const IndexBuffer* indexBuffer)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer ? indexBuffer->m_buffer : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+void swap(IndexBuffer& left, IndexBuffer& right) noexcept
+{
+    left.swap(right);
+}
+
+} // namespace sf
@@ -0,0 +1,139 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/RectPacker.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RectPacker::RectPacker(Vector2u size) : m_size(size)
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Vector2u> RectPacker::pack(Vector2u rectSize)
+{
+    if (rectSize.x == 0u || rectSize.y == 0u || rectSize.x > m_size.x || rectSize.y > m_size.y)
+        return base::nullOpt;
+
+    std::size_t  bestIndex  = m_skyline.size();
+    unsigned int bestY      = 0u;
+    unsigned int bestBottom = m_size.y + 1u;
+
+    for (std::size_t i = 0u; i < m_skyline.size(); ++i)
+    {
+        const unsigned int left = m_skyline[i].x;
+        if (left + rectSize.x > m_size.x)
+            break;
+
+        // The rectangle rests on the highest segment spanned by its width
+        unsigned int y         = 0u;
+        unsigned int remaining = rectSize.x;
+
+        for (std::size_t j = i; remaining > 0u; ++j)
+        {
+            y         = base::max(y, m_skyline[j].y);
+            remaining = m_skyline[j].width >= remaining ? 0u : remaining - m_skyline[j].width;
+        }
+
+        // Prefer the lowest bottom edge, then the leftmost position (segments are sorted)
+        if (y + rectSize.y <= m_size.y && y + rectSize.y < bestBottom)
+        {
+            bestIndex  = i;
+            bestY      = y;
+            bestBottom = y + rectSize.y;
+        }
+    }
+
+    if (bestIndex == m_skyline.size())
+        return base::nullOpt;
+
+    const unsigned int left  = m_skyline[bestIndex].x;
+    const unsigned int right = left + rectSize.x;
+
+    // Raise the skyline over the new rectangle, trimming the segments it now covers
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), Segment{left, bestBottom, rectSize.x});
+
+    std::size_t i = bestIndex + 1u;
+    while (i < m_skyline.size() && m_skyline[i].x < right)
+    {
+        Segment& segment = m_skyline[i];
+
+        if (segment.x + segment.width <= right)
+        {
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+
+        segment.width -= right - segment.x;
+        segment.x = right;
+        break;
+    }
+
+    mergeSegments();
+    return base::makeOptional(Vector2u{left, bestY});
+}
+
+
+////////////////////////////////////////////////////////////
+void RectPacker::grow(Vector2u size)
+{
+    // The new columns on the right are empty
+    if (size.x > m_size.x)
+    {
+        m_skyline.push_back(Segment{m_size.x, 0u, size.x - m_size.x});
+        m_size.x = size.x;
+
+        mergeSegments();
+    }
+
+    m_size.y = base::max(m_size.y, size.y);
+}
+
+
+////////////////////////////////////////////////////////////
+void RectPacker::clear()
+{
+    m_skyline.clear();
+
+    if (m_size.x > 0u)
+        m_skyline.push_back(Segment{0u, 0u, m_size.x});
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u RectPacker::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void RectPacker::mergeSegments()
+{
+    std::size_t last = 0u;
+
+    for (std::size_t i = 1u; i < m_skyline.size(); ++i)
+    {
+        if (m_skyline[i].y == m_skyline[last].y)
+            m_skyline[last].width += m_skyline[i].width;
+        else
+            m_skyline[++last] = m_skyline[i];
+    }
+
+    if (!m_skyline.empty())
+        m_skyline.resize(last + 1u);
+}
+
+} // namespace sf
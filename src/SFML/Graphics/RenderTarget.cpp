@@ -6,15 +6,19 @@
 #include "SFML/Graphics/BlendMode.hpp"
 #include "SFML/Graphics/CoordinateType.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/IndexBuffer.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderTarget.hpp"
 #include "SFML/Graphics/Shader.hpp"
 #include "SFML/Graphics/Shape.hpp"
 #include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/SpriteInstance.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Transform.hpp"
 #include "SFML/Graphics/Vertex.hpp"
 #include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexUtils.hpp"
 #include "SFML/Graphics/View.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
@@ -28,10 +32,13 @@
 #include "SFML/Base/Math/Lround.hpp"
 #include "SFML/Base/Optional.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 
 namespace
@@ -172,6 +179,124 @@ constinit std::atomic<IdType> contextRenderTargetMap[maxIdCount]{};
     return GL_ALWAYS;
 }
 
+
+// Initial size in bytes of the streaming vertex and index buffers
+constexpr std::size_t streamingBufferInitialCapacity{1024ul * 1024ul};
+
+// Byte offsets of the matrices in the `std140` built-in uniform block
+constexpr std::size_t builtInModelViewProjectionOffset{0ul};
+constexpr std::size_t builtInTextureMatrixOffset{sizeof(float) * 16ul};
+
+// Pseudo program id owning the matrices of the built-in uniform block, which are shared by all programs
+constexpr GLuint builtInMatricesOwner{~GLuint{0u}};
+
+// Type of the indices used for indexed drawing
+using IndexType = sf::IndexBuffer::IndexType;
+
+// Maximum number of vertices that can be accumulated by a single batch (or deferred queue), so that
+// its vertices fit in the initial storage of the streaming buffer instead of growing it without bound
+constexpr std::size_t maxBatchVertexCount{streamingBufferInitialCapacity / sizeof(sf::Vertex)};
+
+// Check if primitives of the given type can be merged into a batch
+[[nodiscard]] bool isBatchable(sf::PrimitiveType type)
+{
+    return type == sf::PrimitiveType::Triangles || type == sf::PrimitiveType::TriangleStrip ||
+           type == sf::PrimitiveType::TriangleFan;
+}
+
+// Convert a primitive type to the corresponding OpenGL constant
+[[nodiscard]] GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[static_cast<std::size_t>(type)];
+}
+
+// Append the indices of `quadCount` quads, each made of 4 vertices in triangle strip order
+void appendQuadIndices(std::vector<IndexType>& indices, IndexType baseIndex, std::size_t quadCount)
+{
+    for (std::size_t i = 0u; i < quadCount; ++i)
+    {
+        const auto index = baseIndex + static_cast<IndexType>(i * 4u);
+        indices.insert(indices.end(), {index, index + 1u, index + 2u, index + 2u, index + 1u, index + 3u});
+    }
+}
+
+// Expand triangle-based primitives into an indexed triangle list
+void appendTriangleIndices(std::vector<IndexType>& indices, IndexType baseIndex, std::size_t vertexCount, sf::PrimitiveType type)
+{
+    if (vertexCount < 3u)
+        return;
+
+    if (type == sf::PrimitiveType::Triangles)
+    {
+        const std::size_t usedVertexCount = vertexCount - (vertexCount % 3u);
+        for (std::size_t i = 0u; i < usedVertexCount; ++i)
+            indices.push_back(baseIndex + static_cast<IndexType>(i));
+
+        return;
+    }
+
+    for (std::size_t i = 0u; i < vertexCount - 2u; ++i)
+    {
+        const auto index = baseIndex + static_cast<IndexType>(i);
+
+        if (type == sf::PrimitiveType::TriangleFan)
+            indices.insert(indices.end(), {baseIndex, index + 1u, index + 2u});
+        else if (i % 2u == 0u) // Triangle strip, preserve the winding order
+            indices.insert(indices.end(), {index, index + 1u, index + 2u});
+        else
+            indices.insert(indices.end(), {index + 1u, index, index + 2u});
+    }
+}
+
+// Can draw calls using these render states be merged into a single draw call?
+[[nodiscard]] bool canShareDrawCall(const sf::RenderStates& lhs,
+                                    std::uint64_t           lhsTextureId,
+                                    const sf::RenderStates& rhs,
+                                    std::uint64_t           rhsTextureId)
+{
+    return lhs.texture == rhs.texture && lhsTextureId == rhsTextureId && lhs.shader == rhs.shader &&
+           lhs.blendMode == rhs.blendMode && lhs.stencilMode == rhs.stencilMode &&
+           lhs.coordinateType == rhs.coordinateType &&
+           lhs.distanceFieldOutlineThickness == rhs.distanceFieldOutlineThickness &&
+           lhs.distanceFieldOutlineColor == rhs.distanceFieldOutlineColor;
+}
+
+// A run of batched draw calls recorded in deferred mode, referring to a range of the batch indices
+struct DeferredCommand
+{
+    std::uint64_t    key;          //!< Sort key, see `makeSortKey`
+    std::uint32_t    stencilGroup; //!< Number of stencil mode changes recorded before the run
+    sf::RenderStates states;       //!< Render states shared by the draw calls of the run
+    std::uint64_t    textureId;    //!< Cache id of the texture used by the run
+    std::size_t      indexOffset;  //!< Index of the first batch index of the run
+    std::size_t      indexCount;   //!< Number of batch indices of the run
+};
+
+// Layer (8 bits) | shader program (16 bits) | texture cache id (40 bits)
+[[nodiscard]] std::uint64_t makeSortKey(std::uint8_t layer, const sf::RenderStates& states, std::uint64_t textureId)
+{
+    const std::uint64_t shaderId = states.shader != nullptr ? states.shader->getNativeHandle() : 0u;
+
+    return (std::uint64_t{layer} << 56u) | ((shaderId & 0xFFFFu) << 40u) | (textureId & 0xFF'FFFF'FFFFu);
+}
+
+// Commands are sorted by layer, then by stencil group, then by the rest of their key: a stencil mode change is a
+// sort barrier, so that stencil writes and the stencil tests depending on them are never reordered within a layer
+[[nodiscard]] bool isSubmittedBefore(const DeferredCommand& lhs, const DeferredCommand& rhs)
+{
+    const std::uint64_t lhsLayer = lhs.key >> 56u;
+    const std::uint64_t rhsLayer = rhs.key >> 56u;
+
+    if (lhsLayer != rhsLayer)
+        return lhsLayer < rhsLayer;
+
+    if (lhs.stencilGroup != rhs.stencilGroup)
+        return lhs.stencilGroup < rhs.stencilGroup;
+
+    return lhs.key < rhs.key;
+}
+
 } // namespace RenderTargetImpl
 } // namespace
 
@@ -202,10 +327,25 @@ struct [[nodiscard]] StatesCache
 
     GLuint lastUsedProgramId{}; //!< GL id of the last used shader program
 
+    GLuint boundProgramId{};    //!< GL id of the shader program currently bound
+    bool   vaoBound{};          //!< Is the vertex array object of the render target bound?
+    bool   vertexStreamBound{}; //!< Is the vertex streaming buffer bound to `GL_ARRAY_BUFFER`?
+
+    bool usesBuiltInMatricesBlock{}; //!< Does the last used program declare the built-in matrices uniform block?
+
+    GLuint    modelViewProjectionProgramId{}; //!< GL id of the program (or block) that received the last model-view-projection matrix
+    Transform lastModelViewProjection;        //!< Last uploaded model-view-projection matrix
+
+    GLuint         textureMatrixProgramId{};      //!< GL id of the program (or block) that received the last texture matrix
+    std::uint64_t  textureMatrixTextureId{};      //!< Texture of the last uploaded texture matrix
+    CoordinateType textureMatrixCoordinateType{}; //!< Coordinate type of the last uploaded texture matrix
+
     GLint sfAttribPositionIdx{}; //!< Index of the "sf_a_position" attribute
     GLint sfAttribColorIdx{};    //!< Index of the "sf_a_color" attribute
     GLint sfAttribTexCoordIdx{}; //!< Index of the "sf_a_texCoord" attribute
 
+    GLint sfAttribInstanceIdx[4]{}; //!< Indices of the per-instance attributes, in the order of `instanceAttribs`
+
     base::Optional<Shader::UniformLocation> ulTextureMatrix;             //!< Built-in texture matrix uniform location
     base::Optional<Shader::UniformLocation> ulModelViewProjectionMatrix; //!< Built-in model-view-projection matrix uniform location
 };
@@ -238,6 +378,11 @@ public:
         SFML_BASE_ASSERT(isBound());
     }
 
+    [[nodiscard, gnu::always_inline]] unsigned int getId() const
+    {
+        return m_id;
+    }
+
     [[gnu::always_inline]] ~OpenGLRAII()
     {
         if (m_id != 0u)
@@ -280,9 +425,115 @@ using VBO = OpenGLRAII<[](auto& id) { glCheck(glGenBuffers(1, &id)); },
 
 
 ////////////////////////////////////////////////////////////
-void setupVertexAttribPointers(const GLint sfAttribPositionIdx, const GLint sfAttribColorIdx, const GLint sfAttribTexCoordIdx)
+using EBO = OpenGLRAII<[](auto& id) { glCheck(glGenBuffers(1, &id)); },
+                       [](auto id) { glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id)); },
+                       [](auto& id) { glCheck(glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &id)); },
+                       [](auto& id) { glCheck(glDeleteBuffers(1, &id)); }>;
+
+
+////////////////////////////////////////////////////////////
+using UBO = OpenGLRAII<[](auto& id) { glCheck(glGenBuffers(1, &id)); },
+                       [](auto id) { glCheck(glBindBuffer(GL_UNIFORM_BUFFER, id)); },
+                       [](auto& id) { glCheck(glGetIntegerv(GL_UNIFORM_BUFFER_BINDING, &id)); },
+                       [](auto& id) { glCheck(glDeleteBuffers(1, &id)); }>;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Ring of GPU memory used to stream vertex or index data
+///
+/// Every upload is appended right after the previous one, so
+/// draw calls only need to know the offset of their data.
+/// When the ring is full, the storage is orphaned: the driver
+/// hands out fresh memory while in-flight draw calls keep
+/// reading from the old one, therefore no fence is required
+/// and appended ranges can be mapped without synchronization.
+///
+////////////////////////////////////////////////////////////
+template <typename BufferObject, GLenum Target>
+class StreamingBuffer
 {
-#define SFML_PRIV_OFFSETOF(...) reinterpret_cast<const void*>(offsetof(__VA_ARGS__))
+public:
+    [[nodiscard, gnu::always_inline]] explicit StreamingBuffer(GraphicsContext& graphicsContext) :
+    m_bufferObject(graphicsContext)
+    {
+    }
+
+    [[gnu::always_inline]] void bind() const
+    {
+        m_bufferObject.bind();
+    }
+
+    [[nodiscard, gnu::always_inline]] unsigned int getId() const
+    {
+        return m_bufferObject.getId();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append data to the ring, the buffer must be bound
+    ///
+    /// \return Offset in bytes at which the data was written
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t append(const void* data, std::size_t byteCount, std::size_t alignment)
+    {
+        SFML_BASE_ASSERT(byteCount > 0u && alignment > 0u);
+
+        std::size_t offset = (m_offset + alignment - 1u) / alignment * alignment;
+
+        if (offset + byteCount > m_capacity)
+        {
+            // Grow the storage if the data would not even fit in an empty ring
+            if (m_capacity == 0u)
+                m_capacity = RenderTargetImpl::streamingBufferInitialCapacity;
+
+            while (m_capacity < byteCount)
+                m_capacity *= 2u;
+
+            // Orphan the current storage and start again from the beginning
+            glCheck(glBufferData(Target, static_cast<GLsizeiptr>(m_capacity), nullptr, GL_STREAM_DRAW));
+            offset = 0u;
+        }
+
+#ifdef SFML_SYSTEM_EMSCRIPTEN
+        // Buffer mapping is not available on WebGL
+        glCheck(glBufferSubData(Target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(byteCount), data));
+#else
+        // The range has not been used since the storage was (re)specified, no need to synchronize
+        void* const mapped = glCheckExpr(
+            glMapBufferRange(Target,
+                             static_cast<GLintptr>(offset),
+                             static_cast<GLsizeiptr>(byteCount),
+                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+
+        if (mapped != nullptr)
+        {
+            std::memcpy(mapped, data, byteCount);
+            [[maybe_unused]] const GLboolean unmapped = glCheckExpr(glUnmapBuffer(Target));
+        }
+        else
+        {
+            glCheck(glBufferSubData(Target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(byteCount), data));
+        }
+#endif
+
+        m_offset = offset + byteCount;
+        return offset;
+    }
+
+private:
+    BufferObject m_bufferObject; //!< Underlying OpenGL buffer object
+    std::size_t  m_capacity{};   //!< Size of the current storage, in bytes
+    std::size_t  m_offset{};     //!< Offset of the first free byte in the current storage
+};
+
+
+////////////////////////////////////////////////////////////
+void setupVertexAttribPointers(const GLint       sfAttribPositionIdx,
+                               const GLint       sfAttribColorIdx,
+                               const GLint       sfAttribTexCoordIdx,
+                               const std::size_t baseOffset = 0u)
+{
+#define SFML_PRIV_OFFSETOF(...) reinterpret_cast<const void*>(baseOffset + offsetof(__VA_ARGS__))
 
     SFML_BASE_ASSERT(sfAttribPositionIdx >= 0);
 
@@ -320,13 +571,84 @@ void setupVertexAttribPointers(const GLint sfAttribPositionIdx, const GLint sfAt
 }
 
 
+////////////////////////////////////////////////////////////
+static_assert(sizeof(Transform) == sizeof(float) * 6u, "Instanced drawing relies on the 3x2 layout of sf::Transform");
+
+
+////////////////////////////////////////////////////////////
+struct InstanceAttrib
+{
+    const char* name;       //!< Name of the attribute in the instanced shader
+    GLint       size;       //!< Number of components
+    GLenum      type;       //!< Type of each component
+    GLboolean   normalized; //!< Should the components be normalized?
+    std::size_t offset;     //!< Offset of the attribute in `sf::SpriteInstance`
+};
+
+
+////////////////////////////////////////////////////////////
+constexpr InstanceAttrib instanceAttribs[]{
+    // `sf::Transform` stores the top two rows of its matrix, one after the other
+    {"sf_a_instanceTransformX", 3, GL_FLOAT, GL_FALSE, offsetof(SpriteInstance, transform)},
+    {"sf_a_instanceTransformY", 3, GL_FLOAT, GL_FALSE, offsetof(SpriteInstance, transform) + sizeof(float) * 3u},
+    {"sf_a_instanceTextureRect", 4, GL_FLOAT, GL_FALSE, offsetof(SpriteInstance, textureRect)},
+    {"sf_a_instanceColor", 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(SpriteInstance, color)},
+};
+
+
+////////////////////////////////////////////////////////////
+static_assert(base::getArraySize(instanceAttribs) == sizeof(StatesCache::sfAttribInstanceIdx) / sizeof(GLint));
+
+
+////////////////////////////////////////////////////////////
+/// \brief Set up (or tear down) per-instance attributes
+///
+/// Attribute divisors are part of the VAO state, so they must
+/// be reset after an instanced draw call to avoid affecting
+/// the regular draw calls using the same attribute locations.
+/// The arrays are disabled as well, so that the next program
+/// does not source a stale attribute from the instance data.
+///
+////////////////////////////////////////////////////////////
+void setupInstanceAttribPointers(const GLint (&locations)[4], const std::size_t baseOffset, const bool enable)
+{
+    for (std::size_t i = 0u; i < base::getArraySize(instanceAttribs); ++i)
+    {
+        const InstanceAttrib& attrib   = instanceAttribs[i];
+        const GLint           location = locations[i];
+
+        if (location < 0)
+            continue;
+
+        if (!enable)
+        {
+            glCheck(glVertexAttribDivisor(static_cast<GLuint>(location), 0));
+            glCheck(glDisableVertexAttribArray(static_cast<GLuint>(location)));
+            continue;
+        }
+
+        glCheck(glEnableVertexAttribArray(static_cast<GLuint>(location)));
+        glCheck(glVertexAttribPointer(static_cast<GLuint>(location),
+                                      attrib.size,
+                                      attrib.type,
+                                      attrib.normalized,
+                                      sizeof(SpriteInstance),
+                                      reinterpret_cast<const void*>(baseOffset + attrib.offset)));
+        glCheck(glVertexAttribDivisor(static_cast<GLuint>(location), 1));
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 struct RenderTarget::Impl
 {
     explicit Impl(GraphicsContext& theGraphicsContext) :
     graphicsContext(&theGraphicsContext),
     vao(theGraphicsContext),
-    vbo(theGraphicsContext)
+    vertexStream(theGraphicsContext),
+    indexStream(theGraphicsContext),
+    quadIndexBuffer(theGraphicsContext),
+    builtInMatricesStream(theGraphicsContext)
     {
     }
 
@@ -336,7 +658,74 @@ struct RenderTarget::Impl
     StatesCache              cache{};         //!< Render states cache
     RenderTargetImpl::IdType id{};            //!< Unique number that identifies the render target
     VAO                      vao;             //!< Vertex array object associated with the render target
-    VBO                      vbo;             //!< Vertex buffer object associated with the render target
+
+    StreamingBuffer<VBO, GL_ARRAY_BUFFER>         vertexStream; //!< Ring buffer used to upload vertices
+    StreamingBuffer<EBO, GL_ELEMENT_ARRAY_BUFFER> indexStream;  //!< Ring buffer used to upload batch indices
+    DrawStatistics                                statistics;   //!< Draw calls and uploads since the last reset
+
+    bool                                     batching{};       //!< Are draw calls being batched?
+    std::vector<Vertex>                      batchVertices;    //!< Pre-transformed vertices of the pending batch
+    std::vector<RenderTargetImpl::IndexType> batchIndices;     //!< Triangle indices of the pending batch
+    RenderStates                             batchStates;      //!< Render states shared by the pending batch
+    std::uint64_t                            batchTextureId{}; //!< Cache id of the texture used by the pending batch
+    std::size_t                              batchRunIndexOffset{}; //!< First batch index not yet recorded as a deferred command
+
+    bool                                           deferred{};       //!< Are draw calls recorded as deferred commands?
+    std::uint8_t                                   deferredLayer{};  //!< Layer of the recorded deferred commands
+    std::vector<RenderTargetImpl::DeferredCommand> deferredCommands; //!< Recorded deferred commands
+    std::vector<RenderTargetImpl::IndexType>       deferredIndices;  //!< Batch indices gathered in submission order
+
+    EBO         quadIndexBuffer;      //!< Shared quad index pattern, see `drawQuads`
+    std::size_t quadIndexBufferSize{}; //!< Number of quads covered by `quadIndexBuffer`
+
+    StreamingBuffer<UBO, GL_UNIFORM_BUFFER> builtInMatricesStream;    //!< Ring of versions of the built-in matrices block
+    float                                   builtInMatrices[32]{};    //!< Values of the built-in matrices block
+    std::size_t                             uniformBufferAlignment{}; //!< Alignment of uniform buffer ranges
+
+    ////////////////////////////////////////////////////////////
+    void bindVAO()
+    {
+        if (cache.enable && cache.vaoBound)
+        {
+            ++statistics.redundantCallsAvoided;
+            return;
+        }
+
+        vao.bind();
+        cache.vaoBound = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void bindVertexStream()
+    {
+        if (cache.enable && cache.vertexStreamBound)
+        {
+            ++statistics.redundantCallsAvoided;
+            return;
+        }
+
+        vertexStream.bind();
+        cache.vertexStreamBound = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void uploadBuiltInMatrices()
+    {
+        if (uniformBufferAlignment == 0u)
+            uniformBufferAlignment = static_cast<std::size_t>(priv::getGLInteger(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT));
+
+        // Append a new version of the block instead of overwriting the one that in-flight draw calls read from
+        builtInMatricesStream.bind();
+        const std::size_t offset = builtInMatricesStream.append(builtInMatrices,
+                                                                sizeof(builtInMatrices),
+                                                                uniformBufferAlignment);
+
+        glCheck(glBindBufferRange(GL_UNIFORM_BUFFER,
+                                  Shader::builtInUniformBlockBinding,
+                                  builtInMatricesStream.getId(),
+                                  static_cast<GLintptr>(offset),
+                                  static_cast<GLsizeiptr>(sizeof(builtInMatrices))));
+    }
 };
 
 
@@ -347,7 +736,12 @@ RenderTarget::RenderTarget(GraphicsContext& graphicsContext) : m_impl(graphicsCo
 
 
 ////////////////////////////////////////////////////////////
-RenderTarget::~RenderTarget() = default;
+RenderTarget::~RenderTarget()
+{
+    // Derived targets must submit their pending draw calls while they can still be drawn to
+    SFML_BASE_ASSERT(m_impl->batchIndices.empty() && m_impl->deferredCommands.empty() &&
+                     "Pending batched draw calls were not submitted before destroying the render target");
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -367,6 +761,9 @@ RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
         return false;
     }
 
+    // Pending batched draw calls must happen before the clear
+    flushBatch();
+
     // Unbind texture to fix RenderTexture preventing clear
     unapplyTexture();
 
@@ -415,6 +812,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending batched draw calls must use the previous view
+    flushBatch();
+
     m_impl->view              = view;
     m_impl->cache.viewChanged = true;
 }
@@ -524,6 +924,21 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (vertices == nullptr || (vertexCount == 0))
         return;
 
+    if (isBatching())
+    {
+        if (RenderTargetImpl::isBatchable(type))
+        {
+            RenderTargetImpl::appendTriangleIndices(m_impl->batchIndices,
+                                                    appendToBatch(vertices, vertexCount, states),
+                                                    vertexCount,
+                                                    type);
+            return;
+        }
+
+        // Other primitive types cannot be merged, preserve the drawing order
+        flushBatch();
+    }
+
     if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
     {
         // Check if the vertex count is low enough so that we can pre-transform them
@@ -532,14 +947,7 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
         if (useVertexCache)
         {
             // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                auto& [position, color, texCoords] = m_impl->cache.vertexCache[i];
-
-                position  = states.transform * vertices[i].position;
-                color     = vertices[i].color;
-                texCoords = vertices[i].texCoords;
-            }
+            transformVertices(states.transform, vertices, m_impl->cache.vertexCache, vertexCount);
         }
 
         setupDraw(useVertexCache, states);
@@ -547,12 +955,12 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
         // If we pre-transform the vertices, we must use our internal vertex cache
         const auto* data = reinterpret_cast<const char*>(useVertexCache ? m_impl->cache.vertexCache : vertices);
 
-        glCheck(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount), data, GL_STATIC_DRAW));
+        const std::size_t firstVertex = streamVertices(data, vertexCount);
         setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
                                   m_impl->cache.sfAttribColorIdx,
                                   m_impl->cache.sfAttribTexCoordIdx);
 
-        drawPrimitives(type, 0, vertexCount);
+        drawPrimitives(type, firstVertex, vertexCount);
         cleanupDraw(states);
 
         // Update the cache
@@ -561,6 +969,150 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*       vertices,
+                        std::size_t         vertexCount,
+                        const unsigned int* indices,
+                        std::size_t         indexCount,
+                        PrimitiveType       type,
+                        const RenderStates& states)
+{
+    // Nothing to draw?
+    if (vertices == nullptr || vertexCount == 0 || indices == nullptr || indexCount == 0)
+        return;
+
+    if (isBatching())
+    {
+        if (type == PrimitiveType::Triangles)
+        {
+            const RenderTargetImpl::IndexType baseIndex = appendToBatch(vertices, vertexCount, states);
+            const std::size_t usedIndexCount            = indexCount - (indexCount % 3u);
+
+            for (std::size_t i = 0u; i < usedIndexCount; ++i)
+                m_impl->batchIndices.push_back(baseIndex + indices[i]);
+
+            return;
+        }
+
+        // Other primitive types cannot be merged, preserve the drawing order
+        flushBatch();
+    }
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        setupDraw(/* useVertexCache */ false, states);
+
+        // Point the attributes at the uploaded vertices, so that the indices do not need to be rebased
+        const std::size_t firstVertex = streamVertices(vertices, vertexCount);
+        setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx,
+                                  firstVertex * sizeof(Vertex));
+
+        drawIndexedPrimitives(type, streamIndices(indices, indexCount), indexCount);
+        cleanupDraw(states);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawQuads(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states)
+{
+    SFML_BASE_ASSERT(vertexCount % 4u == 0u && "Quads must be made of exactly 4 vertices each");
+    const std::size_t quadCount = vertexCount / 4u;
+
+    // Nothing to draw?
+    if (vertices == nullptr || quadCount == 0)
+        return;
+
+    if (isBatching())
+    {
+        RenderTargetImpl::appendQuadIndices(m_impl->batchIndices, appendToBatch(vertices, quadCount * 4u, states), quadCount);
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        setupDraw(/* useVertexCache */ false, states);
+
+        const std::size_t firstVertex = streamVertices(vertices, quadCount * 4u);
+        setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx,
+                                  firstVertex * sizeof(Vertex));
+
+        // The quad index pattern never changes, only grow it when more quads are needed
+        m_impl->quadIndexBuffer.bind();
+
+        if (m_impl->quadIndexBufferSize < quadCount)
+        {
+            m_impl->quadIndexBufferSize = base::max(quadCount, m_impl->quadIndexBufferSize * 2u);
+
+            std::vector<RenderTargetImpl::IndexType> quadIndices;
+            quadIndices.reserve(m_impl->quadIndexBufferSize * 6u);
+            RenderTargetImpl::appendQuadIndices(quadIndices, 0u, m_impl->quadIndexBufferSize);
+
+            const std::size_t byteCount = sizeof(RenderTargetImpl::IndexType) * quadIndices.size();
+            glCheck(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(byteCount), quadIndices.data(), GL_STATIC_DRAW));
+
+            m_impl->statistics.uploadedBytes += byteCount;
+        }
+
+        drawIndexedPrimitives(PrimitiveType::Triangles, 0u, quadCount * 6u);
+        cleanupDraw(states);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const Texture&        texture,
+                                 const SpriteInstance* instances,
+                                 std::size_t           instanceCount,
+                                 const RenderStates&   states)
+{
+    // Nothing to draw?
+    if (instances == nullptr || instanceCount == 0)
+        return;
+
+    flushBatch();
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        // Texture rectangles of the instances are always expressed in pixels
+        RenderStates instancedStates   = states;
+        instancedStates.texture        = &texture;
+        instancedStates.coordinateType = CoordinateType::Pixels;
+
+        if (instancedStates.shader == nullptr)
+            instancedStates.shader = &m_impl->graphicsContext->getBuiltInInstancedShader();
+
+        setupDraw(/* useVertexCache */ false, instancedStates);
+
+        const std::size_t byteCount = sizeof(SpriteInstance) * instanceCount;
+        const std::size_t offset = m_impl->vertexStream.append(instances, byteCount, alignof(SpriteInstance));
+        m_impl->statistics.uploadedBytes += byteCount;
+
+        // The quad corners are derived from the vertex index, only the instances are fetched from memory
+        setupInstanceAttribPointers(m_impl->cache.sfAttribInstanceIdx, offset, /* enable */ true);
+
+        glCheck(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instanceCount)));
+        ++m_impl->statistics.drawCalls;
+
+        setupInstanceAttribPointers(m_impl->cache.sfAttribInstanceIdx, offset, /* enable */ false);
+        cleanupDraw(instancedStates);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
 {
@@ -589,6 +1141,9 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     if (!vertexCount || !vertexBuffer.getNativeHandle())
         return;
 
+    // Preserve the drawing order with respect to pending batched draw calls
+    flushBatch();
+
     if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
     {
         setupDraw(false, states);
@@ -605,6 +1160,7 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 
         // Unbind vertex buffer
         VertexBuffer::bind(*vertexBuffer.m_graphicsContext, nullptr);
+        m_impl->cache.vertexStreamBound = false;
 
         cleanupDraw(states);
 
@@ -614,6 +1170,296 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable(*m_impl->graphicsContext))
+    {
+        priv::err() << "sf::VertexBuffer is not available, drawing skipped";
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = base::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    // Preserve the drawing order with respect to pending batched draw calls
+    flushBatch();
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex and index buffers
+        VertexBuffer::bind(*m_impl->graphicsContext, &vertexBuffer);
+        IndexBuffer::bind(*m_impl->graphicsContext, &indexBuffer);
+
+        setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx);
+
+        drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), firstIndex * sizeof(IndexBuffer::IndexType), indexCount);
+
+        // Unbind vertex and index buffers
+        IndexBuffer::bind(*m_impl->graphicsContext, nullptr);
+        VertexBuffer::bind(*m_impl->graphicsContext, nullptr);
+        m_impl->cache.vertexStreamBound = false;
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::beginBatch()
+{
+    m_impl->batching = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endBatch()
+{
+    flushBatch();
+    m_impl->batching = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flushBatch()
+{
+    if (m_impl->deferred)
+    {
+        recordDeferredCommand();
+        submitDeferredCommands();
+        return;
+    }
+
+    // Nothing to draw?
+    if (m_impl->batchIndices.empty())
+    {
+        m_impl->batchVertices.clear();
+        return;
+    }
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        // Batched vertices are pre-transformed, so the vertex cache path (identity model-view) applies
+        setupDraw(/* useVertexCache */ true, m_impl->batchStates);
+
+        // Base vertex offsets are not available everywhere, point the attributes at the uploaded vertices instead
+        const std::size_t firstVertex = streamVertices(m_impl->batchVertices.data(), m_impl->batchVertices.size());
+        setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx,
+                                  firstVertex * sizeof(Vertex));
+
+        drawIndexedPrimitives(PrimitiveType::Triangles,
+                              streamIndices(m_impl->batchIndices.data(), m_impl->batchIndices.size()),
+                              m_impl->batchIndices.size());
+        cleanupDraw(m_impl->batchStates);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = true;
+    }
+
+    m_impl->batchVertices.clear();
+    m_impl->batchIndices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatching() const
+{
+    return m_impl->batching || m_impl->deferred;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::beginDeferred()
+{
+    // Submit the pending batch, if any, so that it is not reordered with the deferred commands
+    if (!m_impl->deferred)
+        flushBatch();
+
+    m_impl->deferred = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endDeferred()
+{
+    flushBatch();
+    m_impl->deferred = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setDeferredLayer(std::uint8_t layer)
+{
+    if (m_impl->deferred)
+        recordDeferredCommand();
+
+    m_impl->deferredLayer = layer;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t RenderTarget::getDeferredLayer() const
+{
+    return m_impl->deferredLayer;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isDeferred() const
+{
+    return m_impl->deferred;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::recordDeferredCommand()
+{
+    const std::size_t indexOffset = m_impl->batchRunIndexOffset;
+    const std::size_t indexCount  = m_impl->batchIndices.size() - indexOffset;
+
+    // Nothing to record?
+    if (indexCount == 0)
+        return;
+
+    // The stencil group changes with the stencil mode, starting from 0 in each queue
+    std::uint32_t stencilGroup = 0u;
+
+    if (!m_impl->deferredCommands.empty())
+    {
+        const RenderTargetImpl::DeferredCommand& previous = m_impl->deferredCommands.back();
+
+        stencilGroup = previous.stencilGroup;
+        if (previous.states.stencilMode != m_impl->batchStates.stencilMode)
+            ++stencilGroup;
+    }
+
+    m_impl->deferredCommands.push_back(
+        {RenderTargetImpl::makeSortKey(m_impl->deferredLayer, m_impl->batchStates, m_impl->batchTextureId),
+         stencilGroup,
+         m_impl->batchStates,
+         m_impl->batchTextureId,
+         indexOffset,
+         indexCount});
+
+    m_impl->batchRunIndexOffset = m_impl->batchIndices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::submitDeferredCommands()
+{
+    auto& commands = m_impl->deferredCommands;
+
+    if (!commands.empty() && (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true)))
+    {
+        // Equal keys keep their recording order
+        std::stable_sort(commands.begin(), commands.end(), &RenderTargetImpl::isSubmittedBefore);
+
+        // Gather the indices in submission order, so that all the commands can be uploaded at once
+        m_impl->deferredIndices.clear();
+        m_impl->deferredIndices.reserve(m_impl->batchIndices.size());
+
+        for (const RenderTargetImpl::DeferredCommand& command : commands)
+            m_impl->deferredIndices.insert(m_impl->deferredIndices.end(),
+                                           m_impl->batchIndices.begin() + static_cast<std::ptrdiff_t>(command.indexOffset),
+                                           m_impl->batchIndices.begin() +
+                                               static_cast<std::ptrdiff_t>(command.indexOffset + command.indexCount));
+
+        std::size_t firstVertex      = 0u;
+        std::size_t indexByteOffset  = 0u;
+        std::size_t submittedIndices = 0u;
+
+        for (std::size_t i = 0u; i < commands.size();)
+        {
+            const RenderTargetImpl::DeferredCommand& command = commands[i];
+
+            // Merge the following commands sharing the same render states into a single draw call
+            std::size_t indexCount = command.indexCount;
+
+            for (++i; i < commands.size() && RenderTargetImpl::canShareDrawCall(commands[i].states,
+                                                                                  commands[i].textureId,
+                                                                                  command.states,
+                                                                                  command.textureId);
+                 ++i)
+                indexCount += commands[i].indexCount;
+
+            // Deferred vertices are pre-transformed, so the vertex cache path (identity model-view) applies
+            setupDraw(/* useVertexCache */ true, command.states);
+
+            // The index buffer binding is part of the VAO state, so only upload once the VAO is bound
+            if (submittedIndices == 0u)
+            {
+                firstVertex     = streamVertices(m_impl->batchVertices.data(), m_impl->batchVertices.size());
+                indexByteOffset = streamIndices(m_impl->deferredIndices.data(), m_impl->deferredIndices.size());
+            }
+
+            setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+                                      m_impl->cache.sfAttribColorIdx,
+                                      m_impl->cache.sfAttribTexCoordIdx,
+                                      firstVertex * sizeof(Vertex));
+
+            drawIndexedPrimitives(PrimitiveType::Triangles,
+                                  indexByteOffset + submittedIndices * sizeof(RenderTargetImpl::IndexType),
+                                  indexCount);
+            cleanupDraw(command.states);
+
+            submittedIndices += indexCount;
+        }
+
+        // Update the cache
+        m_impl->cache.useVertexCache = true;
+    }
+
+    commands.clear();
+    m_impl->batchVertices.clear();
+    m_impl->batchIndices.clear();
+    m_impl->batchRunIndexOffset = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::DrawStatistics& RenderTarget::getDrawStatistics() const
+{
+    return m_impl->statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetDrawStatistics()
+{
+    m_impl->statistics = {};
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -668,6 +1514,16 @@ bool RenderTarget::setActive(bool active)
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
+{
+    // Pending batched draw calls must happen before the direct OpenGL rendering
+    flushBatch();
+
+    resetGLStatesImpl();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetGLStatesImpl()
 {
     // Check here to make sure a context change does not happen after activate(true)
     const bool vertexBufferAvailable = VertexBuffer::isAvailable(*m_impl->graphicsContext);
@@ -725,15 +1581,23 @@ void RenderTarget::resetGLStates()
         applyBlendMode(BlendAlpha);
         applyStencilMode(StencilMode());
         unapplyTexture();
-        applyShader(/* shader */ nullptr);
+
+        // The bindings might have been modified by the user, reset them without going through the cache
+        Shader::unbind(*m_impl->graphicsContext);
 
         if (vertexBufferAvailable)
             glCheck(VertexBuffer::bind(*m_impl->graphicsContext, nullptr));
 
+        m_impl->cache.boundProgramId               = 0u;
+        m_impl->cache.vaoBound                     = false;
+        m_impl->cache.vertexStreamBound            = false;
+        m_impl->cache.modelViewProjectionProgramId = 0u;
+        m_impl->cache.textureMatrixProgramId       = 0u;
+
         m_impl->cache.useVertexCache = false;
 
-        // Set the default view
-        setView(getView());
+        // Set the default view (not through `setView`, which would flush the pending batch)
+        m_impl->cache.viewChanged = true;
 
         m_impl->cache.enable = true;
     }
@@ -922,10 +1786,24 @@ void RenderTarget::unapplyTexture()
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyShader(const Shader* shader)
 {
+    const unsigned int programId = shader != nullptr ? shader->getNativeHandle() : 0u;
+
+    // The program is already bound, but the textures of its sampler uniforms might have changed
+    if (m_impl->cache.enable && programId == m_impl->cache.boundProgramId)
+    {
+        if (shader != nullptr)
+            shader->bindTextures();
+
+        ++m_impl->statistics.redundantCallsAvoided;
+        return;
+    }
+
     if (shader != nullptr)
         shader->bind();
     else
         Shader::unbind(*m_impl->graphicsContext);
+
+    m_impl->cache.boundProgramId = programId;
 }
 
 
@@ -948,16 +1826,21 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 
     // First set the persistent OpenGL states if it's the very first call
     if (!m_impl->cache.glStatesSet)
-        resetGLStates();
+        resetGLStatesImpl();
 
     const Shader& usedShader = states.shader != nullptr ? *states.shader : m_impl->graphicsContext->getBuiltInShader();
 
+    // The outline of the built-in distance field shader is a uniform, set it for this draw call only
+    if (&usedShader == &m_impl->graphicsContext->getBuiltInDistanceFieldShader())
+        m_impl->graphicsContext->setBuiltInDistanceFieldOutline(states.distanceFieldOutlineThickness,
+                                                                states.distanceFieldOutlineColor);
+
     // Apply the shader
     applyShader(&usedShader);
 
     // Bind GL objects
-    m_impl->vao.bind();
-    m_impl->vbo.bind();
+    m_impl->bindVAO();
+    m_impl->bindVertexStream();
 
     // Update cache
     const auto usedNativeHandle  = usedShader.getNativeHandle();
@@ -979,18 +1862,63 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         updateCacheAttrib(m_impl->cache.sfAttribColorIdx, "sf_a_color");
         updateCacheAttrib(m_impl->cache.sfAttribTexCoordIdx, "sf_a_texCoord");
 
+        // Per-instance attributes are only enabled for the duration of an instanced draw call
+        for (std::size_t i = 0u; i < base::getArraySize(instanceAttribs); ++i)
+            m_impl->cache.sfAttribInstanceIdx[i] = glCheckExpr(
+                glGetAttribLocation(usedNativeHandle, instanceAttribs[i].name));
+
         m_impl->cache.ulTextureMatrix             = usedShader.getUniformLocation("sf_u_textureMatrix");
         m_impl->cache.ulModelViewProjectionMatrix = usedShader.getUniformLocation("sf_u_modelViewProjectionMatrix");
+
+        const GLuint blockIndex = glCheckExpr(glGetUniformBlockIndex(usedNativeHandle, "sf_u_BuiltInMatrices"));
+        m_impl->cache.usesBuiltInMatricesBlock = blockIndex != GL_INVALID_INDEX;
     }
 
+    // Matrices are either stored in the built-in uniform block, shared by all programs, or in per-program uniforms
+    const bool   usesBuiltInMatricesBlock = m_impl->cache.usesBuiltInMatricesBlock;
+    const GLuint matricesOwner = usesBuiltInMatricesBlock ? RenderTargetImpl::builtInMatricesOwner : usedNativeHandle;
+
+    // Changes to the block are only uploaded once both matrices are known, see `uploadBuiltInMatrices`
+    bool builtInMatricesChanged = false;
+
+    const auto uploadMatrix =
+        [&](const base::Optional<Shader::UniformLocation>& location, std::size_t blockOffset, const float* matrix)
+    {
+        if (usesBuiltInMatricesBlock)
+        {
+            std::memcpy(m_impl->builtInMatrices + blockOffset / sizeof(float), matrix, sizeof(float) * 16u);
+            builtInMatricesChanged = true;
+        }
+        else if (location.hasValue())
+        {
+            usedShader.setMat4Uniform(*location, matrix);
+        }
+    };
+
     // Apply the view
     if (!m_impl->cache.enable || m_impl->cache.viewChanged)
         applyCurrentView();
 
-    // Set the model-view-projection matrix
+    // Set the model-view-projection matrix, uniforms are part of the program state
     const Transform& modelViewMatrix(useVertexCache ? Transform::Identity : states.transform);
-    usedShader.setMat4Uniform(*m_impl->cache.ulModelViewProjectionMatrix,
-                              (m_impl->view.getTransform() * modelViewMatrix).getMatrix());
+    const Transform  modelViewProjection = m_impl->view.getTransform() * modelViewMatrix;
+
+    if (!m_impl->cache.enable || m_impl->cache.modelViewProjectionProgramId != matricesOwner ||
+        modelViewProjection != m_impl->cache.lastModelViewProjection)
+    {
+        float modelViewProjectionMatrix[16];
+        modelViewProjection.getMatrix(modelViewProjectionMatrix);
+        uploadMatrix(m_impl->cache.ulModelViewProjectionMatrix,
+                     RenderTargetImpl::builtInModelViewProjectionOffset,
+                     modelViewProjectionMatrix);
+
+        m_impl->cache.modelViewProjectionProgramId = matricesOwner;
+        m_impl->cache.lastModelViewProjection      = modelViewProjection;
+    }
+    else
+    {
+        ++m_impl->statistics.redundantCallsAvoided;
+    }
 
     // Apply the blend mode
     if (!m_impl->cache.enable || (states.blendMode != m_impl->cache.lastBlendMode))
@@ -1021,43 +1949,137 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
                                   states.coordinateType != m_impl->cache.lastCoordinateType;
 
     if (mustApplyTexture)
-    {
         applyTexture(usedTexture, states.coordinateType);
 
-        if (m_impl->cache.ulTextureMatrix.hasValue())
-        {
-            // clang-format off
-            float textureMatrixBuffer[]{1.f, 0.f, 0.f, 0.f,
-                                        0.f, 1.f, 0.f, 0.f,
-                                        0.f, 0.f, 1.f, 0.f,
-                                        0.f, 0.f, 0.f, 1.f};
-            // clang-format on
-
-            usedTexture.getMatrix(textureMatrixBuffer, m_impl->cache.lastCoordinateType);
-            usedShader.setMat4Uniform(*m_impl->cache.ulTextureMatrix, textureMatrixBuffer);
-        }
+    // Set the texture matrix, if the shader uses it and it differs from the one the program already has
+    if (!usesBuiltInMatricesBlock && !m_impl->cache.ulTextureMatrix.hasValue())
+        return;
+
+    if (m_impl->cache.enable && m_impl->cache.textureMatrixProgramId == matricesOwner &&
+        m_impl->cache.textureMatrixTextureId == usedTextureId &&
+        m_impl->cache.textureMatrixCoordinateType == states.coordinateType)
+    {
+        ++m_impl->statistics.redundantCallsAvoided;
+    }
+    else
+    {
+        // clang-format off
+        float textureMatrixBuffer[]{1.f, 0.f, 0.f, 0.f,
+                                    0.f, 1.f, 0.f, 0.f,
+                                    0.f, 0.f, 1.f, 0.f,
+                                    0.f, 0.f, 0.f, 1.f};
+        // clang-format on
+
+        usedTexture.getMatrix(textureMatrixBuffer, states.coordinateType);
+        uploadMatrix(m_impl->cache.ulTextureMatrix, RenderTargetImpl::builtInTextureMatrixOffset, textureMatrixBuffer);
+
+        m_impl->cache.textureMatrixProgramId      = matricesOwner;
+        m_impl->cache.textureMatrixTextureId      = usedTextureId;
+        m_impl->cache.textureMatrixCoordinateType = states.coordinateType;
+    }
+
+    if (builtInMatricesChanged)
+        m_impl->uploadBuiltInMatrices();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTarget::appendToBatch(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states)
+{
+    const std::uint64_t textureId = states.texture != nullptr ? states.texture->m_cacheId : 0ul;
+
+    // Flush the pending draw calls if they cannot be merged with this one
+    const auto hasPendingRun = [&] { return m_impl->batchIndices.size() > m_impl->batchRunIndexOffset; };
+
+    if (!m_impl->batchVertices.empty() &&
+        m_impl->batchVertices.size() + vertexCount > RenderTargetImpl::maxBatchVertexCount)
+    {
+        // Full, submit everything (in deferred mode, the queue recorded so far is sorted and submitted early)
+        flushBatch();
     }
+    else if (hasPendingRun() &&
+             !RenderTargetImpl::canShareDrawCall(states, textureId, m_impl->batchStates, m_impl->batchTextureId))
+    {
+        // In deferred mode, the pending draw calls are only recorded, to be sorted and submitted later
+        if (m_impl->deferred)
+            recordDeferredCommand();
+        else
+            flushBatch();
+    }
+
+    if (!hasPendingRun())
+    {
+        m_impl->batchStates           = states;
+        m_impl->batchStates.transform = Transform::Identity;
+        m_impl->batchTextureId        = textureId;
+    }
+
+    // Pre-transform the vertices, so that draw calls with different transforms can be merged
+    const std::size_t baseIndex = m_impl->batchVertices.size();
+    m_impl->batchVertices.resize(baseIndex + vertexCount);
+
+    transformVertices(states.transform, vertices, m_impl->batchVertices.data() + baseIndex, vertexCount);
+
+    return static_cast<RenderTargetImpl::IndexType>(baseIndex);
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
-    // Find the OpenGL primitive type
-    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[static_cast<std::size_t>(type)];
+    // Draw the primitives, using the VAO bound in `setupDraw`
+    glCheck(glDrawArrays(RenderTargetImpl::primitiveTypeToGlConstant(type),
+                         static_cast<GLint>(firstVertex),
+                         static_cast<GLsizei>(vertexCount)));
+
+    ++m_impl->statistics.drawCalls;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type, std::size_t indexOffset, std::size_t indexCount)
+{
+    // Draw the primitives, using the index buffer bound to the VAO
+    glCheck(glDrawElements(RenderTargetImpl::primitiveTypeToGlConstant(type),
+                           static_cast<GLsizei>(indexCount),
+                           GL_UNSIGNED_INT,
+                           reinterpret_cast<const void*>(indexOffset)));
+
+    ++m_impl->statistics.drawCalls;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::streamVertices(const void* vertices, std::size_t vertexCount)
+{
+    const std::size_t byteCount = sizeof(Vertex) * vertexCount;
+
+    // Aligning to the vertex size allows the offset to be expressed as a first vertex index
+    m_impl->bindVertexStream();
+    const std::size_t offset = m_impl->vertexStream.append(vertices, byteCount, sizeof(Vertex));
+
+    m_impl->statistics.uploadedBytes += byteCount;
+    return offset / sizeof(Vertex);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::streamIndices(const unsigned int* indices, std::size_t indexCount)
+{
+    const std::size_t byteCount = sizeof(RenderTargetImpl::IndexType) * indexCount;
+
+    m_impl->indexStream.bind();
+    const std::size_t offset = m_impl->indexStream.append(indices, byteCount, sizeof(RenderTargetImpl::IndexType));
 
-    // Draw the primitives
-    m_impl->vao.bind();
-    glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+    m_impl->statistics.uploadedBytes += byteCount;
+    return offset;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
-    // Unbind the shader, if any
-    applyShader(/* shader */ nullptr);
+    // The shader is left bound, the next draw call will most likely use it again
 
     // If the texture we used to draw belonged to a RenderTexture, then forcibly unbind that texture.
     // This prevents a bug where some drivers do not clear RenderTextures properly.
@@ -1090,6 +2112,9 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   To avoid that, when the vertex count is low enough, we
 //   pre-transform them and therefore use an identity transform
 //   to render them.
+//   When batching is enabled, this is taken further: all the
+//   pre-transformed triangles sharing the same states are
+//   accumulated and drawn with a single indexed draw call.
 //
 // * Blending mode
 //   Since it overloads the == operator, we can easily check
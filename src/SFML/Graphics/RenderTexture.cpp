@@ -34,7 +34,11 @@ struct RenderTexture::Impl
 
 
 ////////////////////////////////////////////////////////////
-RenderTexture::~RenderTexture() = default;
+RenderTexture::~RenderTexture()
+{
+    // Submit any pending batched draw call while the texture can still be drawn to
+    flushBatch();
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -161,6 +165,9 @@ bool RenderTexture::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTexture::display()
 {
+    // Submit any pending batched draw call before updating the texture
+    flushBatch();
+
     if (priv::RenderTextureImplFBO::isAvailable(getGraphicsContext()))
     {
         // Perform a RenderTarget-only activation if we are using FBOs
@@ -66,6 +66,9 @@ RenderWindow::~RenderWindow()
     // Need to activate window context during destruction to avoid GL errors
     [[maybe_unused]] const bool rc = setActive(true);
     SFML_BASE_ASSERT(rc);
+
+    // Submit any pending batched draw call while the window can still be drawn to
+    flushBatch();
 }
 
 
@@ -143,6 +146,16 @@ void RenderWindow::setSize(const Vector2u& size)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderWindow::display()
+{
+    // Submit any pending batched draw call before presenting the frame
+    flushBatch();
+
+    Window::display();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderWindow::onResize()
 {
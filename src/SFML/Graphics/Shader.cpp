@@ -253,20 +253,15 @@ public:
     /// \brief Constructor: set up state before uniform is set
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline]] explicit UniformBinder(unsigned int shaderProgram) :
-    m_currentProgram(static_cast<GLEXT_GLhandle>(castToGlHandle(shaderProgram)))
+    [[nodiscard, gnu::always_inline]] explicit UniformBinder(GraphicsContext& graphicsContext, unsigned int shaderProgram) :
+    m_currentProgram(shaderProgram),
+    m_savedProgram(graphicsContext.getActiveThreadLocalGlContextProgram())
     {
         SFML_BASE_ASSERT(m_currentProgram != 0);
 
-// Enable program object
-#ifndef SFML_OPENGL_ES
-        glCheck(m_savedProgram = GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
-#else
-        glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, reinterpret_cast<GLint*>(&m_savedProgram)));
-#endif
-
+        // Enable program object, the previous binding is tracked on the CPU to avoid a pipeline stall
         if (m_currentProgram != m_savedProgram)
-            glCheck(GLEXT_glUseProgramObject(m_currentProgram));
+            glCheck(GLEXT_glUseProgramObject(castToGlHandle(m_currentProgram)));
     }
 
     ////////////////////////////////////////////////////////////
@@ -276,8 +271,8 @@ public:
     [[gnu::always_inline]] ~UniformBinder()
     {
         // Disable program object
-        if (m_currentProgram && (m_currentProgram != m_savedProgram))
-            glCheck(GLEXT_glUseProgramObject(m_savedProgram));
+        if (m_currentProgram != m_savedProgram)
+            glCheck(GLEXT_glUseProgramObject(castToGlHandle(m_savedProgram)));
     }
 
     ////////////////////////////////////////////////////////////
@@ -293,8 +288,8 @@ public:
     UniformBinder& operator=(const UniformBinder&) = delete;
 
 private:
-    GLEXT_GLhandle m_currentProgram; //!< Handle to the program object of the modified `sf::Shader` instance
-    GLEXT_GLhandle m_savedProgram{}; //!< Handle to the previously active program object
+    unsigned int m_currentProgram; //!< Handle to the program object of the modified `sf::Shader` instance
+    unsigned int m_savedProgram;   //!< Handle to the previously active program object
 };
 
 
@@ -603,10 +598,31 @@ base::Optional<Shader::UniformLocation> Shader::getUniformLocation(std::string_v
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlockBinding(std::string_view blockName, unsigned int bindingPoint) const
+{
+    SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    SFML_BASE_ASSERT(bindingPoint != builtInUniformBlockBinding && "Binding point reserved for built-in matrices");
+
+    // Use thread-local string buffer to get a null-terminated block name
+    thread_local std::string blockNameBuffer;
+    blockNameBuffer.clear();
+    blockNameBuffer.assign(blockName);
+
+    // Uniform block bindings are program state, no need to bind the program
+    const GLuint blockIndex = glCheckExpr(glGetUniformBlockIndex(m_impl->shaderProgram, blockNameBuffer.c_str()));
+    if (blockIndex == GL_INVALID_INDEX)
+        return false;
+
+    glCheck(glUniformBlockBinding(m_impl->shaderProgram, blockIndex, bindingPoint));
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, float x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform1f(location.m_value, x));
 }
 
@@ -614,7 +630,7 @@ void Shader::setUniform(UniformLocation location, float x) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Vec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform2f(location.m_value, v.x, v.y));
 }
 
@@ -622,7 +638,7 @@ void Shader::setUniform(UniformLocation location, Glsl::Vec2 v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform3f(location.m_value, v.x, v.y, v.z));
 }
 
@@ -630,7 +646,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Vec3& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform4f(location.m_value, v.x, v.y, v.z, v.w));
 }
 
@@ -638,7 +654,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Vec4& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, int x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform1i(location.m_value, x));
 }
 
@@ -646,7 +662,7 @@ void Shader::setUniform(UniformLocation location, int x) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Ivec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform2i(location.m_value, v.x, v.y));
 }
 
@@ -654,7 +670,7 @@ void Shader::setUniform(UniformLocation location, Glsl::Ivec2 v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform3i(location.m_value, v.x, v.y, v.z));
 }
 
@@ -662,7 +678,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Ivec3& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform4i(location.m_value, v.x, v.y, v.z, v.w));
 }
 
@@ -698,7 +714,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Bvec4& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Mat3& matrix) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix3fv(location.m_value, 1, GL_FALSE, matrix.array));
 }
 
@@ -706,7 +722,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Mat3& matrix) cons
 ////////////////////////////////////////////////////////////
 void Shader::setMat4Uniform(UniformLocation location, const float* matrixPtr) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix4fv(location.m_value, 1, GL_FALSE, matrixPtr));
 }
 
@@ -760,7 +776,7 @@ void Shader::setUniform(UniformLocation location, CurrentTextureType)
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(UniformLocation location, const float* scalarArray, std::size_t length)
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform1fv(location.m_value, static_cast<GLsizei>(length), scalarArray));
 }
 
@@ -769,7 +785,7 @@ void Shader::setUniformArray(UniformLocation location, const float* scalarArray,
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vectorArray, std::size_t length)
 {
     std::vector<float>  contiguous = flatten(vectorArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform2fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
 }
 
@@ -778,7 +794,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vectorA
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vectorArray, std::size_t length)
 {
     std::vector<float>  contiguous = flatten(vectorArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform3fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
 }
 
@@ -787,7 +803,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vectorA
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec4* vectorArray, std::size_t length)
 {
     std::vector<float>  contiguous = flatten(vectorArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform4fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
 }
 
@@ -801,7 +817,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat3* matrixA
     for (std::size_t i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix3fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
 }
 
@@ -815,7 +831,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat4* matrixA
     for (std::size_t i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix4fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
 }
 
@@ -832,6 +848,8 @@ void Shader::bind() const
 {
     SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
+    m_impl->graphicsContext->setActiveThreadLocalGlContextProgram(m_impl->shaderProgram);
+
     if (m_impl->shaderProgram == 0)
     {
         // Bind no shader
@@ -852,11 +870,12 @@ void Shader::bind() const
 }
 
 
-void Shader::unbind([[maybe_unused]] GraphicsContext& graphicsContext)
+void Shader::unbind(GraphicsContext& graphicsContext)
 {
     SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
 
     // Bind no shader
+    graphicsContext.setActiveThreadLocalGlContextProgram(0u);
     glCheck(GLEXT_glUseProgramObject({}));
 }
 
@@ -1017,6 +1036,11 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         return base::nullOpt;
     }
 
+    // Feed the built-in matrices block, if declared, from its reserved binding point
+    if (const GLuint blockIndex = glCheckExpr(glGetUniformBlockIndex(castFromGlHandle(shaderProgram), "sf_u_BuiltInMatrices"));
+        blockIndex != GL_INVALID_INDEX)
+        glCheck(glUniformBlockBinding(castFromGlHandle(shaderProgram), blockIndex, builtInUniformBlockBinding));
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
@@ -1028,6 +1052,10 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
 ////////////////////////////////////////////////////////////
 void Shader::bindTextures() const
 {
+    // Nothing to bind, leave the active texture unit untouched
+    if (m_impl->textures.empty())
+        return;
+
     auto it = m_impl->textures.begin();
     for (std::size_t i = 0; i < m_impl->textures.size(); ++i)
     {
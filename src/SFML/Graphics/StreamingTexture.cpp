@@ -0,0 +1,272 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/StreamingTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureSaver.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace StreamingTextureImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getLevelCount(sf::Vector2u size)
+{
+    unsigned int count = 1u;
+
+    for (unsigned int largest = sf::base::max(size.x, size.y); largest > 1u; largest /= 2u)
+        ++count;
+
+    return count;
+}
+
+} // namespace StreamingTextureImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+StreamingTexture::StreamingTexture(base::PassKey<StreamingTexture>&&,
+                                   Texture&&                            texture,
+                                   std::vector<base::Optional<Image>>&& levels) :
+m_texture(SFML_BASE_MOVE(texture)),
+m_levels(SFML_BASE_MOVE(levels)),
+m_residentLevel(static_cast<unsigned int>(m_levels.size()))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingTexture::StreamingTexture(StreamingTexture&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+StreamingTexture& StreamingTexture::operator=(StreamingTexture&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+base::Optional<StreamingTexture> StreamingTexture::create(GraphicsContext& graphicsContext,
+                                                          const Image&     image,
+                                                          bool             sRgb,
+                                                          unsigned int     mipTailSize)
+{
+    base::Optional<StreamingTexture> result; // Use a single local variable for NRVO
+
+    base::Optional<Texture> texture = Texture::create(graphicsContext, image.getSize(), sRgb);
+    if (!texture.hasValue())
+    {
+        priv::err() << "Failed to create streaming texture";
+        return result; // Empty optional
+    }
+
+    // Build the whole mipmap chain on the CPU, following the size of the actual texture
+    const unsigned int levelCount = StreamingTextureImpl::getLevelCount(texture->m_actualSize);
+
+    std::vector<base::Optional<Image>> levels;
+    levels.reserve(levelCount);
+    levels.emplace_back(image);
+
+    while (levels.size() < levelCount)
+        levels.emplace_back(levels.back()->createDownsampled());
+
+    {
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
+
+        // Allocate all the levels, so that the texture is complete whatever the resident level
+        for (unsigned int level = 1u; level < levelCount; ++level)
+        {
+            glCheck(glTexImage2D(GL_TEXTURE_2D,
+                                 static_cast<GLint>(level),
+                                 (texture->m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                                 static_cast<GLsizei>(base::max(texture->m_actualSize.x >> level, 1u)),
+                                 static_cast<GLsizei>(base::max(texture->m_actualSize.y >> level, 1u)),
+                                 0,
+                                 GL_RGBA,
+                                 GL_UNSIGNED_BYTE,
+                                 nullptr));
+        }
+
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(levelCount - 1u)));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levelCount - 1u)));
+        glCheck(glTexParameteri(GL_TEXTURE_2D,
+                                GL_TEXTURE_MIN_FILTER,
+                                texture->m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+
+        texture->m_hasMipmap = true;
+    }
+
+    result.emplace(base::PassKey<StreamingTexture>{}, SFML_BASE_MOVE(*texture), SFML_BASE_MOVE(levels));
+    StreamingTexture& streamingTexture = *result;
+
+    // Upload the mip tail right away, including at least the smallest level so that the texture can be drawn
+    while (streamingTexture.m_residentLevel > 0u)
+    {
+        const Vector2u size = streamingTexture.m_levels[streamingTexture.m_residentLevel - 1u]->getSize();
+
+        if ((streamingTexture.m_residentLevel < levelCount) && ((size.x > mipTailSize) || (size.y > mipTailSize)))
+            break;
+
+        [[maybe_unused]] const std::size_t uploaded = streamingTexture.uploadRows(size.y);
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t StreamingTexture::stream(std::size_t byteBudget)
+{
+    std::size_t uploaded = 0u;
+
+    while (m_residentLevel > m_targetLevel)
+    {
+        const Vector2u    size    = m_levels[m_residentLevel - 1u]->getSize();
+        const std::size_t rowSize = static_cast<std::size_t>(size.x) * 4u;
+
+        const std::size_t remaining = byteBudget - base::min(uploaded, byteBudget);
+        auto              rowCount  = static_cast<unsigned int>(base::min(remaining / rowSize, std::size_t{size.y}));
+
+        if (rowCount == 0u)
+        {
+            // Make some progress even with a tiny budget
+            if (uploaded > 0u)
+                break;
+
+            rowCount = 1u;
+        }
+
+        uploaded += uploadRows(rowCount);
+    }
+
+    return uploaded;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::setTargetLevel(unsigned int level)
+{
+    m_targetLevel = base::min(level, getLevelCount() - 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int StreamingTexture::getTargetLevel() const
+{
+    return m_targetLevel;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int StreamingTexture::getResidentLevel() const
+{
+    return m_residentLevel;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int StreamingTexture::getLevelCount() const
+{
+    return static_cast<unsigned int>(m_levels.size());
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t StreamingTexture::getPendingBytes() const
+{
+    std::size_t bytes = 0u;
+
+    for (unsigned int level = m_targetLevel; level < m_residentLevel; ++level)
+    {
+        const Vector2u size = m_levels[level]->getSize();
+        bytes += static_cast<std::size_t>(size.x) * size.y * 4u;
+    }
+
+    // Part of the next level may already be uploaded
+    if (m_residentLevel > m_targetLevel)
+        bytes -= static_cast<std::size_t>(m_levels[m_residentLevel - 1u]->getSize().x) * m_uploadedRows * 4u;
+
+    return bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+void StreamingTexture::setSmooth(bool smooth)
+{
+    m_texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& StreamingTexture::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t StreamingTexture::uploadRows(unsigned int rowCount)
+{
+    SFML_BASE_ASSERT(m_residentLevel > 0u);
+    SFML_BASE_ASSERT(m_texture.m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    const unsigned int level = m_residentLevel - 1u;
+    const Image&       image = *m_levels[level];
+    const Vector2u     size  = image.getSize();
+
+    rowCount = base::min(rowCount, size.y - m_uploadedRows);
+
+    const std::size_t rowSize = static_cast<std::size_t>(size.x) * 4u;
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture.m_texture));
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            static_cast<GLint>(level),
+                            0,
+                            static_cast<GLint>(m_uploadedRows),
+                            static_cast<GLsizei>(size.x),
+                            static_cast<GLsizei>(rowCount),
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            image.getPixelsPtr() + m_uploadedRows * rowSize));
+
+    m_uploadedRows += rowCount;
+
+    if (m_uploadedRows == size.y)
+    {
+        // The level is complete: sample it from now on, its CPU copy is not needed anymore
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(level)));
+
+        m_levels[level].reset();
+        m_residentLevel = level;
+        m_uploadedRows  = 0u;
+    }
+
+    return rowCount * rowSize;
+}
+
+} // namespace sf
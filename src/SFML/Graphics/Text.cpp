@@ -6,7 +6,7 @@
 #include "SFML/Graphics/Color.hpp"
 #include "SFML/Graphics/Font.hpp"
 #include "SFML/Graphics/Glyph.hpp"
-#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderTarget.hpp"
 #include "SFML/Graphics/Text.hpp"
@@ -16,6 +16,8 @@
 #include "SFML/System/Rect.hpp"
 #include "SFML/System/String.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Math/Ceil.hpp"
 #include "SFML/Base/Math/Fabs.hpp"
@@ -30,9 +32,10 @@
 
 namespace
 {
-// Add an underline or strikethrough line to the vertex array
+// Add an underline or strikethrough line quad to the vertex array
 void addLine(std::vector<sf::Vertex>& vertices,
              std::size_t&             index,
+             float                    lineLeft,
              float                    lineLength,
              float                    lineTop,
              sf::Color                color,
@@ -43,15 +46,16 @@ void addLine(std::vector<sf::Vertex>& vertices,
     const float top    = sf::base::floor(lineTop + offset - (thickness / 2) + 0.5f);
     const float bottom = top + sf::base::floor(thickness + 0.5f);
 
-    const sf::Vertex vertexData[] = {{{-outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}},
-                                     {{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}},
-                                     {{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}},
-                                     {{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}},
-                                     {{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}},
-                                     {{lineLength + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}}};
+    const float left  = lineLeft - outlineThickness;
+    const float right = lineLeft + lineLength + outlineThickness;
 
-    std::memcpy(vertices.data() + index, vertexData, sizeof(sf::Vertex) * 6);
-    index += 6;
+    const sf::Vertex vertexData[] = {{{left, top - outlineThickness}, color, {1.0f, 1.0f}},
+                                     {{right, top - outlineThickness}, color, {1.0f, 1.0f}},
+                                     {{left, bottom + outlineThickness}, color, {1.0f, 1.0f}},
+                                     {{right, bottom + outlineThickness}, color, {1.0f, 1.0f}}};
+
+    std::memcpy(vertices.data() + index, vertexData, sizeof(sf::Vertex) * 4);
+    index += 4;
 }
 
 // Add a glyph quad to the vertex array
@@ -60,9 +64,10 @@ void addGlyphQuad(std::vector<sf::Vertex>& vertices,
                   sf::Vector2f             position,
                   sf::Color                color,
                   const sf::Glyph&         glyph,
-                  float                    italicShear)
+                  float                    italicShear,
+                  float                    paddingSize)
 {
-    const sf::Vector2f padding(1.f, 1.f);
+    const sf::Vector2f padding(paddingSize, paddingSize);
 
     const sf::Vector2f p1 = glyph.bounds.position - padding;
     const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
@@ -73,12 +78,10 @@ void addGlyphQuad(std::vector<sf::Vertex>& vertices,
     const sf::Vertex vertexData[] = {{position + sf::Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}},
                                      {position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}},
                                      {position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}},
-                                     {position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}},
-                                     {position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}},
                                      {position + sf::Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}}};
 
-    std::memcpy(vertices.data() + index, vertexData, sizeof(sf::Vertex) * 6);
-    index += 6;
+    std::memcpy(vertices.data() + index, vertexData, sizeof(sf::Vertex) * 4);
+    index += 4;
 }
 
 } // namespace
@@ -89,20 +92,29 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct Text::Impl
 {
-    const Font*                 font{};                     //!< Font used to display the string
-    String                      string;                     //!< String to display
-    unsigned int                characterSize{30};          //!< Base size of characters, in pixels
-    float                       letterSpacingFactor{1.f};   //!< Spacing factor between letters
-    float                       lineSpacingFactor{1.f};     //!< Spacing factor between lines
-    Style                       style{Style::Regular};      //!< Text style (see Style enum)
-    Color                       fillColor{Color::White};    //!< Text fill color
-    Color                       outlineColor{Color::Black}; //!< Text outline color
-    float                       outlineThickness{0.f};      //!< Thickness of the text's outline
-    mutable std::vector<Vertex> vertices;                   //!< Vertex array containing the outline and fill geometry
-    mutable std::size_t         fillVerticesStartIndex{};   //!< Index in the vertex array where the fill vertices start
-    mutable FloatRect           bounds;                     //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool                geometryNeedUpdate{};       //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t       fontTextureId{};            //!< The font texture id
+    const Font*                      font{};                     //!< Font used to display the string
+    String                           string;                     //!< String to display
+    unsigned int                     characterSize{30};          //!< Base size of characters, in pixels
+    float                            letterSpacingFactor{1.f};   //!< Spacing factor between letters
+    float                            lineSpacingFactor{1.f};     //!< Spacing factor between lines
+    Style                            style{Style::Regular};      //!< Text style (see Style enum)
+    Color                            fillColor{Color::White};    //!< Text fill color
+    Color                            outlineColor{Color::Black}; //!< Text outline color
+    float                            outlineThickness{0.f};      //!< Thickness of the text's outline
+    Alignment                        alignment{Alignment::Left}; //!< Horizontal alignment of the lines
+    float                            maxWidth{0.f};              //!< Width at which lines are wrapped, 0 for none
+    mutable std::vector<Vertex>      vertices;                   //!< Vertex array of the outline and fill geometry
+    mutable std::size_t              fillVerticesStartIndex{};   //!< Index in the vertex array of the first fill vertex
+    mutable FloatRect                bounds;                     //!< Bounding rectangle of the text (local coordinates)
+    mutable bool                     geometryNeedUpdate{};       //!< Does the geometry need to be recomputed?
+    mutable bool                     geometryAppendOnly{};       //!< Were characters only appended since last update?
+    mutable std::uint64_t            fontTextureId{};            //!< The font texture id
+    mutable std::vector<Vector2f>    characterPositions;         //!< Position of each character, then of the string end
+    mutable std::vector<float>       characterKernings;          //!< Kerning of each character with the previous one
+    mutable std::vector<LineMetrics> lines;                      //!< Metrics of the laid out lines
+    mutable std::uint32_t            lastCharacter{};            //!< Last laid out character, for kerning
+    mutable Vector2f                 glyphsMin;                  //!< Top-left corner of the glyphs, without outline
+    mutable Vector2f                 glyphsMax;                  //!< Bottom-right corner of the glyphs, without outline
 
     explicit Impl(const Font& theFont, String theString, unsigned int theCharacterSize) :
     font(&theFont),
@@ -110,6 +122,16 @@ struct Text::Impl
     characterSize(theCharacterSize)
     {
     }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the whole geometry for recomputation
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateGeometry()
+    {
+        geometryNeedUpdate = true;
+        geometryAppendOnly = false;
+    }
 };
 
 
@@ -153,8 +175,15 @@ void Text::setString(const String& string)
     if (m_impl->string == string)
         return;
 
+    // Characters appended to the string can be laid out after the existing ones, instead of from scratch
+    const std::size_t oldSize       = m_impl->string.getSize();
+    const bool        isValidLayout = !m_impl->geometryNeedUpdate || m_impl->geometryAppendOnly;
+    const bool        isAppend      = isValidLayout && string.getSize() > oldSize &&
+                             std::memcmp(string.getData(), m_impl->string.getData(), oldSize * sizeof(char32_t)) == 0;
+
     m_impl->string             = string;
     m_impl->geometryNeedUpdate = true;
+    m_impl->geometryAppendOnly = isAppend;
 }
 
 
@@ -171,8 +200,8 @@ void Text::setFont(const Font& font)
     if (m_impl->font == &font)
         return;
 
-    m_impl->font               = &font;
-    m_impl->geometryNeedUpdate = true;
+    m_impl->font = &font;
+    m_impl->invalidateGeometry();
 }
 
 
@@ -182,8 +211,8 @@ void Text::setCharacterSize(unsigned int size)
     if (m_impl->characterSize == size)
         return;
 
-    m_impl->characterSize      = size;
-    m_impl->geometryNeedUpdate = true;
+    m_impl->characterSize = size;
+    m_impl->invalidateGeometry();
 }
 
 
@@ -194,7 +223,7 @@ void Text::setLetterSpacing(float spacingFactor)
         return;
 
     m_impl->letterSpacingFactor = spacingFactor;
-    m_impl->geometryNeedUpdate  = true;
+    m_impl->invalidateGeometry();
 }
 
 
@@ -204,8 +233,8 @@ void Text::setLineSpacing(float spacingFactor)
     if (m_impl->lineSpacingFactor == spacingFactor)
         return;
 
-    m_impl->lineSpacingFactor  = spacingFactor;
-    m_impl->geometryNeedUpdate = true;
+    m_impl->lineSpacingFactor = spacingFactor;
+    m_impl->invalidateGeometry();
 }
 
 
@@ -215,8 +244,8 @@ void Text::setStyle(Text::Style style)
     if (m_impl->style == style)
         return;
 
-    m_impl->style              = style;
-    m_impl->geometryNeedUpdate = true;
+    m_impl->style = style;
+    m_impl->invalidateGeometry();
 }
 
 
@@ -229,8 +258,8 @@ void Text::setFillColor(Color color)
     m_impl->fillColor = color;
 
     // Change vertex colors directly, no need to update whole geometry
-    // (if geometry is updated anyway, we can skip this step)
-    if (!m_impl->geometryNeedUpdate)
+    // (if geometry is updated anyway, we can skip this step, unless only new characters are added to it)
+    if (!m_impl->geometryNeedUpdate || m_impl->geometryAppendOnly)
     {
         for (std::size_t i = m_impl->fillVerticesStartIndex; i < m_impl->vertices.size(); ++i)
             m_impl->vertices[i].color = m_impl->fillColor;
@@ -247,8 +276,8 @@ void Text::setOutlineColor(Color color)
     m_impl->outlineColor = color;
 
     // Change vertex colors directly, no need to update whole geometry
-    // (if geometry is updated anyway, we can skip this step)
-    if (!m_impl->geometryNeedUpdate)
+    // (if geometry is updated anyway, we can skip this step, unless only new characters are added to it)
+    if (!m_impl->geometryNeedUpdate || m_impl->geometryAppendOnly)
     {
         for (std::size_t i = 0; i < m_impl->fillVerticesStartIndex; ++i)
             m_impl->vertices[i].color = m_impl->outlineColor;
@@ -262,8 +291,30 @@ void Text::setOutlineThickness(float thickness)
     if (thickness == m_impl->outlineThickness)
         return;
 
-    m_impl->outlineThickness   = thickness;
-    m_impl->geometryNeedUpdate = true;
+    m_impl->outlineThickness = thickness;
+    m_impl->invalidateGeometry();
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setAlignment(Alignment alignment)
+{
+    if (m_impl->alignment == alignment)
+        return;
+
+    m_impl->alignment = alignment;
+    m_impl->invalidateGeometry();
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setMaxWidth(float maxWidth)
+{
+    if (m_impl->maxWidth == maxWidth)
+        return;
+
+    m_impl->maxWidth = maxWidth;
+    m_impl->invalidateGeometry();
 }
 
 
@@ -330,53 +381,98 @@ float Text::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+Text::Alignment Text::getAlignment() const
+{
+    return m_impl->alignment;
+}
+
+
+////////////////////////////////////////////////////////////
+float Text::getMaxWidth() const
+{
+    return m_impl->maxWidth;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
+    // The positions of the characters are computed along with the geometry
+    ensureGeometryUpdate();
+
     // Adjust the index if it's out of range
-    index = base::min(index, m_impl->string.getSize());
+    index = base::min(index, m_impl->characterPositions.size() - 1);
+
+    // Transform the position to global coordinates
+    return getTransform().transformPoint(m_impl->characterPositions[index]);
+}
 
-    // Precompute the variables needed by the algorithm
-    const bool  isBold          = !!(m_impl->style & Style::Bold);
-    float       whitespaceWidth = m_impl->font->getGlyph(U' ', m_impl->characterSize, isBold).advance;
-    const float letterSpacing   = (whitespaceWidth / 3.f) * (m_impl->letterSpacingFactor - 1.f);
-    whitespaceWidth += letterSpacing;
-    const float lineSpacing = m_impl->font->getLineSpacing(m_impl->characterSize) * m_impl->lineSpacingFactor;
 
-    // Compute the position
-    Vector2f      position;
-    std::uint32_t prevChar = 0;
-    for (std::size_t i = 0; i < index; ++i)
+////////////////////////////////////////////////////////////
+std::size_t Text::findCharacterIndex(Vector2f point) const
+{
+    ensureGeometryUpdate();
+
+    const Vector2f localPoint = getInverseTransform().transformPoint(point);
+
+    // Find the line under the point, the lines are sorted from top to bottom
+    std::size_t lineIndex = 0;
+    std::size_t lineEnd   = m_impl->lines.size();
+
+    while (lineEnd - lineIndex > 1)
     {
-        const std::uint32_t curChar = m_impl->string[i];
+        const std::size_t middle = lineIndex + (lineEnd - lineIndex) / 2;
 
-        // Apply the kerning offset
-        position.x += m_impl->font->getKerning(prevChar, curChar, m_impl->characterSize, isBold);
-        prevChar = curChar;
+        if (m_impl->lines[middle].position.y <= localPoint.y)
+            lineIndex = middle;
+        else
+            lineEnd = middle;
+    }
 
-        // Handle special characters
-        switch (curChar)
-        {
-            case U' ':
-                position.x += whitespaceWidth;
-                continue;
-            case U'\t':
-                position.x += whitespaceWidth * 4;
-                continue;
-            case U'\n':
-                position.y += lineSpacing;
-                position.x = 0;
-                continue;
-        }
+    const LineMetrics& line = m_impl->lines[lineIndex];
 
-        // For regular characters, add the advance offset of the glyph
-        position.x += m_impl->font->getGlyph(curChar, m_impl->characterSize, isBold).advance + letterSpacing;
+    // The cursor can go before each character of the line, or at the end of the string on the last line
+    const bool        isLastLine = lineIndex == m_impl->lines.size() - 1;
+    const std::size_t first      = line.firstCharacter;
+    const std::size_t last       = isLastLine ? m_impl->string.getSize() : first + line.characterCount - 1;
+
+    // Find the closest character boundary
+    std::size_t closest         = first;
+    float       closestDistance = base::fabs(m_impl->characterPositions[first].x - localPoint.x);
+
+    for (std::size_t i = first + 1; i <= last; ++i)
+    {
+        const float distance = base::fabs(m_impl->characterPositions[i].x - localPoint.x);
+
+        // Positions only grow along a line, there is no closer one past this point
+        if (distance > closestDistance)
+            break;
+
+        closest         = i;
+        closestDistance = distance;
     }
 
-    // Transform the position to global coordinates
-    position = getTransform().transformPoint(position);
+    return closest;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Text::getLineCount() const
+{
+    ensureGeometryUpdate();
 
-    return position;
+    return m_impl->lines.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Text::LineMetrics& Text::getLineMetrics(std::size_t index) const
+{
+    ensureGeometryUpdate();
+
+    SFML_BASE_ASSERT(index < m_impl->lines.size() && "Line index out of range");
+    return m_impl->lines[index];
 }
 
 
@@ -405,7 +501,19 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     states.texture        = &m_impl->font->getTexture(m_impl->characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
-    target.draw(m_impl->vertices.data(), m_impl->vertices.size(), PrimitiveType::Triangles, states);
+    // Distance field glyphs are drawn, and outlined, by a dedicated shader
+    if (m_impl->font->isDistanceFieldEnabled() && states.shader == nullptr)
+    {
+        // Convert the thickness to distance field units, where the spread maps to 0.5
+        const float spread    = m_impl->font->getDistanceFieldSpread(m_impl->characterSize);
+        const float thickness = base::min(base::fabs(m_impl->outlineThickness) / (2.f * spread), 0.5f);
+
+        states.shader                        = &m_impl->font->getGraphicsContext().getBuiltInDistanceFieldShader();
+        states.distanceFieldOutlineThickness = thickness;
+        states.distanceFieldOutlineColor     = thickness == 0.f ? Color::Transparent : m_impl->outlineColor;
+    }
+
+    target.drawQuads(m_impl->vertices.data(), m_impl->vertices.size(), states);
 }
 
 
@@ -420,33 +528,66 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
+    const std::uint64_t textureId = m_impl->font->getTexture(m_impl->characterSize).m_cacheId;
+
     // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_impl->geometryNeedUpdate && m_impl->font->getTexture(m_impl->characterSize).m_cacheId == m_impl->fontTextureId)
+    if (!m_impl->geometryNeedUpdate && textureId == m_impl->fontTextureId)
         return;
 
+    // Compute values related to the text style
+    const bool  isBold          = !!(m_impl->style & Style::Bold);
+    const bool  isUnderlined    = !!(m_impl->style & Style::Underlined);
+    const bool  isStrikeThrough = !!(m_impl->style & Style::StrikeThrough);
+    const float italicShear     = !!(m_impl->style & Style::Italic) ? degrees(12).asRadians() : 0.f;
+
+    // Appended characters are laid out after the existing ones, unless lines spanning the whole text must be redrawn,
+    // or the appended characters can move the existing ones (wrapping, alignment)
+    const bool isAppend = m_impl->geometryAppendOnly && textureId == m_impl->fontTextureId && !isUnderlined &&
+                          !isStrikeThrough && m_impl->maxWidth == 0.f && m_impl->alignment == Alignment::Left;
+
     // Save the current fonts texture id
-    m_impl->fontTextureId = m_impl->font->getTexture(m_impl->characterSize).m_cacheId;
+    m_impl->fontTextureId = textureId;
 
     // Mark geometry as updated
     m_impl->geometryNeedUpdate = false;
+    m_impl->geometryAppendOnly = false;
 
-    // Clear the previous geometry
-    m_impl->vertices.clear();
-    m_impl->fillVerticesStartIndex = 0u;
-    m_impl->bounds                 = {};
+    const float lineSpacing = m_impl->font->getLineSpacing(m_impl->characterSize) * m_impl->lineSpacingFactor;
+
+    if (!isAppend)
+    {
+        // Clear the previous geometry
+        m_impl->vertices.clear();
+        m_impl->fillVerticesStartIndex = 0u;
+        m_impl->bounds                 = {};
+
+        m_impl->characterPositions.assign(1u, Vector2f{});
+        m_impl->characterKernings.clear();
+        m_impl->lines.assign(1u, LineMetrics{0u, 0u, Vector2f{}, 0.f, lineSpacing});
+        m_impl->lastCharacter = 0u;
+        m_impl->glyphsMin     = {static_cast<float>(m_impl->characterSize), static_cast<float>(m_impl->characterSize)};
+        m_impl->glyphsMax     = {0.f, 0.f};
+    }
+
+    // The end of the string is about to be laid out again, or replaced by the appended characters
+    const Vector2f endPosition = m_impl->characterPositions.back();
+    m_impl->characterPositions.pop_back();
+    const std::size_t firstCharacter = m_impl->characterPositions.size();
 
     // No text: nothing to draw
     if (m_impl->string.isEmpty())
+    {
+        m_impl->characterPositions.emplace_back();
         return;
+    }
 
-    // Compute values related to the text style
-    const bool  isBold             = !!(m_impl->style & Style::Bold);
-    const bool  isUnderlined       = !!(m_impl->style & Style::Underlined);
-    const bool  isStrikeThrough    = !!(m_impl->style & Style::StrikeThrough);
-    const float italicShear        = !!(m_impl->style & Style::Italic) ? degrees(12).asRadians() : 0.f;
     const float underlineOffset    = m_impl->font->getUnderlinePosition(m_impl->characterSize);
     const float underlineThickness = m_impl->font->getUnderlineThickness(m_impl->characterSize);
 
+    // Distance field glyphs include their spread and are outlined by the shader, lines still need outline quads
+    const bool  isDistanceField  = m_impl->font->isDistanceFieldEnabled();
+    const float glyphQuadPadding = isDistanceField ? 0.f : 1.f;
+
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
@@ -456,185 +597,272 @@ void Text::ensureGeometryUpdate() const
     float       whitespaceWidth = m_impl->font->getGlyph(U' ', m_impl->characterSize, isBold).advance;
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_impl->letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
-    const float lineSpacing = m_impl->font->getLineSpacing(m_impl->characterSize) * m_impl->lineSpacingFactor;
 
-    // TODO P1: docs and cleanup
-    std::size_t fillQuadCount    = 0;
-    std::size_t outlineQuadCount = 0;
+    const auto                characterSize  = static_cast<float>(m_impl->characterSize);
+    const float               maxWidth       = m_impl->maxWidth;
+    const std::size_t         characterCount = m_impl->string.getSize();
+    const char32_t*           characters     = m_impl->string.getData();
+    std::vector<LineMetrics>& lines          = m_impl->lines;
 
-    {
-        float x = 0.f;
+    m_impl->characterPositions.resize(characterCount + 1u);
+    m_impl->characterKernings.resize(characterCount);
 
-        const std::size_t outlineQuadIncrement = (m_impl->outlineThickness == 0) ? 0 : 1;
+    Vector2f* positions = m_impl->characterPositions.data();
+    float*    kernings  = m_impl->characterKernings.data();
 
-        const auto addLinesFake = [&]
+    const auto getAdvance = [&](std::uint32_t character)
+    {
+        switch (character)
         {
-            outlineQuadCount += outlineQuadIncrement;
-            ++fillQuadCount;
-        };
+            case U' ':
+                return whitespaceWidth;
+            case U'\t':
+                return whitespaceWidth * 4;
+            case U'\n':
+                return 0.f;
+            default:
+                return m_impl->font->getGlyph(character, m_impl->characterSize, isBold).advance + letterSpacing;
+        }
+    };
 
-        const auto addGlyphsFake = addLinesFake;
+    // Lay out the characters, and break the lines, in a single pass over the new characters
+    float         x          = endPosition.x;
+    float         lineTop    = endPosition.y;
+    std::uint32_t prevChar   = m_impl->lastCharacter;
+    std::size_t   glyphCount = 0;   // Number of characters that need a quad
+    std::size_t   breakIndex = 0;   // Index following the last space or tabulation of the current line, 0 if none
+    float         breakWidth = 0.f; // Width of the current line before its last space or tabulation
 
-        std::uint32_t prevChar = 0;
+    const auto startLine = [&](std::size_t first)
+    {
+        lineTop += lineSpacing;
+        lines.push_back({first, 0u, Vector2f{0.f, lineTop}, 0.f, lineSpacing});
 
-        for (const std::uint32_t curChar : m_impl->string)
-        {
-            // Skip the \r char to avoid weird graphical issues
-            if (curChar == U'\r')
-                continue;
+        x          = 0.f;
+        prevChar   = 0u;
+        breakIndex = 0u;
+    };
 
-            // Apply the kerning offset
-            x += 1.f;
+    for (std::size_t i = firstCharacter; i < characterCount; ++i)
+    {
+        const std::uint32_t curChar = characters[i];
 
-            // If we're using the underlined or strike through style and there's a new line, draw a line
-            if ((curChar == U'\n' && prevChar != U'\n') && (isUnderlined || isStrikeThrough))
-                addLinesFake();
+        // Skip the \r char to avoid weird graphical issues
+        if (curChar == U'\r')
+        {
+            positions[i] = {x, lineTop};
+            kernings[i]  = 0.f;
+            continue;
+        }
 
-            prevChar = curChar;
+        const bool  isWhitespace = (curChar == U' ') || (curChar == U'\n') || (curChar == U'\t');
+        const float advance      = getAdvance(curChar);
+        float       kerning      = m_impl->font->getKerning(prevChar, curChar, m_impl->characterSize, isBold);
 
-            // Handle special characters
-            if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+        // Wrap the line before a character that doesn't fit, whitespace is allowed to hang past the end
+        while (maxWidth > 0.f && !isWhitespace && i > lines.back().firstCharacter && x + kerning + advance > maxWidth)
+        {
+            LineMetrics& line = lines.back();
+
+            if (breakIndex > 0u)
             {
-                switch (curChar)
+                // Break after the last space or tabulation, and move the beginning of the word to the new line
+                line.characterCount = breakIndex - line.firstCharacter;
+                line.width          = breakWidth;
+                startLine(breakIndex);
+
+                for (std::size_t j = lines.back().firstCharacter; j < i; ++j)
                 {
-                    case U' ':
-                        x += 1.f;
-                        break;
-                    case U'\t':
-                        x += 1.f;
-                        break;
-                    case U'\n':
-                        x = 0;
-                        break;
-                }
+                    positions[j] = {x, lineTop};
+                    kernings[j]  = 0.f;
 
-                // Next glyph, no need to create a quad for whitespace
-                continue;
+                    if (characters[j] == U'\r')
+                        continue;
+
+                    kernings[j] = m_impl->font->getKerning(prevChar, characters[j], m_impl->characterSize, isBold);
+                    x += kernings[j] + getAdvance(characters[j]);
+                    prevChar = characters[j];
+                }
+            }
+            else
+            {
+                // The word is wider than a line, break it before the character
+                line.characterCount = i - line.firstCharacter;
+                line.width          = x;
+                startLine(i);
             }
 
-            // Apply the outline
-            addGlyphsFake();
+            kerning = m_impl->font->getKerning(prevChar, curChar, m_impl->characterSize, isBold);
+        }
+
+        // Remember where the character is, for findCharacterPos, and where its glyph goes
+        positions[i] = {x, lineTop};
+        kernings[i]  = kerning;
+
+        // Apply the kerning offset
+        x += kerning;
 
-            // Advance to the next character
-            x += letterSpacing;
+        if (curChar == U'\n')
+        {
+            LineMetrics& line   = lines.back();
+            line.characterCount = i + 1 - line.firstCharacter;
+            line.width          = x;
+            startLine(i + 1);
+            continue;
         }
 
-        // If we're using the underlined style, add the last line
-        if (isUnderlined && (x > 0))
-            addLinesFake();
+        if (isWhitespace)
+        {
+            breakIndex = i + 1;
+            breakWidth = x;
+        }
+        else
+        {
+            ++glyphCount;
+        }
 
-        // If we're using the strike through style, add the last line across all characters
-        if (isStrikeThrough && (x > 0))
-            addLinesFake();
+        // Advance to the next character
+        x += advance;
+        prevChar = curChar;
     }
 
-    const std::size_t outlineVertexCount = outlineQuadCount * 6;
-    const std::size_t fillVertexCount    = fillQuadCount * 6;
+    // Close the last line, the end of the string belongs to it
+    LineMetrics& lastLine   = lines.back();
+    lastLine.characterCount = characterCount - lastLine.firstCharacter;
+    lastLine.width          = x;
 
-    m_impl->vertices.resize(outlineVertexCount + fillVertexCount);
-    m_impl->fillVerticesStartIndex = outlineVertexCount;
+    positions[characterCount] = {x, lineTop};
+    m_impl->lastCharacter     = prevChar;
 
-    std::size_t currFillIndex    = outlineVertexCount;
-    std::size_t currOutlineIndex = 0;
+    // Align the lines, now that their widths are known
+    if (m_impl->alignment != Alignment::Left)
+    {
+        float alignmentWidth = maxWidth;
 
-    float x = 0.f;
-    auto  y = static_cast<float>(m_impl->characterSize);
+        if (alignmentWidth == 0.f)
+            for (const LineMetrics& line : lines)
+                alignmentWidth = base::max(alignmentWidth, line.width);
 
-    // Create one quad for each character
-    auto  minX = static_cast<float>(m_impl->characterSize);
-    auto  minY = static_cast<float>(m_impl->characterSize);
-    float maxX = 0.f;
-    float maxY = 0.f;
+        const float factor = (m_impl->alignment == Alignment::Center) ? 0.5f : 1.f;
 
-    std::uint32_t prevChar = 0;
+        for (LineMetrics& line : lines)
+        {
+            line.position.x = base::floor((alignmentWidth - line.width) * factor);
 
-    const auto addLines = [this, &currFillIndex, &currOutlineIndex, &x, &y, &underlineThickness](float offset)
-    {
-        addLine(m_impl->vertices, currFillIndex, x, y, m_impl->fillColor, offset, underlineThickness);
+            const std::size_t end = line.firstCharacter + line.characterCount + (&line == &lastLine ? 1u : 0u);
+            for (std::size_t i = line.firstCharacter; i < end; ++i)
+                positions[i].x += line.position.x;
+        }
+    }
 
-        if (m_impl->outlineThickness != 0)
-            addLine(m_impl->vertices, currOutlineIndex, x, y, m_impl->outlineColor, offset, underlineThickness, m_impl->outlineThickness);
-    };
+    // Count the quads: one per glyph, and one per underline or strike through line
+    std::size_t lineQuadCount = 0;
 
-    for (const std::uint32_t curChar : m_impl->string)
-    {
-        // Skip the \r char to avoid weird graphical issues
-        if (curChar == U'\r')
-            continue;
+    if (isUnderlined || isStrikeThrough)
+        for (const LineMetrics& line : lines)
+            if (line.width > 0.f)
+                lineQuadCount += (isUnderlined ? 1u : 0u) + (isStrikeThrough ? 1u : 0u);
 
-        // Apply the kerning offset
-        x += m_impl->font->getKerning(prevChar, curChar, m_impl->characterSize, isBold);
+    const std::size_t fillQuadCount    = glyphCount + lineQuadCount;
+    const std::size_t outlineQuadCount = (m_impl->outlineThickness == 0)
+                                             ? 0u
+                                             : (isDistanceField ? 0u : glyphCount) + lineQuadCount;
 
-        if (curChar == U'\n' && prevChar != U'\n')
-        {
-            // If we're using the underlined style and there's a new line, draw a line
-            if (isUnderlined)
-                addLines(underlineOffset);
+    const std::size_t outlineVertexCount = outlineQuadCount * 4;
+    const std::size_t fillVertexCount    = fillQuadCount * 4;
 
-            // If we're using the strike through style and there's a new line, draw a line across all characters
-            if (isStrikeThrough)
-                addLines(strikeThroughOffset);
-        }
+    // The new outline vertices go after the existing ones, but before all the fill vertices
+    const std::size_t oldVertexCount            = m_impl->vertices.size();
+    const std::size_t oldFillVerticesStartIndex = m_impl->fillVerticesStartIndex;
 
-        prevChar = curChar;
+    m_impl->vertices.resize(oldVertexCount + outlineVertexCount + fillVertexCount);
+    m_impl->fillVerticesStartIndex = oldFillVerticesStartIndex + outlineVertexCount;
+
+    if (outlineVertexCount > 0u)
+        std::memmove(m_impl->vertices.data() + m_impl->fillVerticesStartIndex,
+                     m_impl->vertices.data() + oldFillVerticesStartIndex,
+                     sizeof(Vertex) * (oldVertexCount - oldFillVerticesStartIndex));
+
+    std::size_t currFillIndex    = oldVertexCount + outlineVertexCount;
+    std::size_t currOutlineIndex = oldFillVerticesStartIndex;
+
+    // Create one quad for each character
+    float minX = m_impl->glyphsMin.x;
+    float minY = m_impl->glyphsMin.y;
+    float maxX = m_impl->glyphsMax.x;
+    float maxY = m_impl->glyphsMax.y;
+
+    for (std::size_t i = firstCharacter; i < characterCount; ++i)
+    {
+        const std::uint32_t curChar = characters[i];
+
+        if (curChar == U'\r')
+            continue;
+
+        // Glyphs sit on the baseline, after the kerning offset
+        const Vector2f position{positions[i].x + kernings[i], positions[i].y + characterSize};
 
         // Handle special characters
         if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
         {
-            // Update the current bounds (min coordinates)
-            minX = base::min(minX, x);
-            minY = base::min(minY, y);
-
-            switch (curChar)
-            {
-                case U' ':
-                    x += whitespaceWidth;
-                    break;
-                case U'\t':
-                    x += whitespaceWidth * 4;
-                    break;
-                case U'\n':
-                    y += lineSpacing;
-                    x = 0;
-                    break;
-            }
+            // A space or tabulation where the line was wrapped hangs past its end, it doesn't count in the bounds
+            if (curChar != U'\n' && positions[i + 1].y != positions[i].y)
+                continue;
 
-            // Update the current bounds (max coordinates)
-            maxX = base::max(maxX, x);
-            maxY = base::max(maxY, y);
+            // Update the current bounds
+            minX = base::min(minX, position.x);
+            minY = base::min(minY, position.y);
+            maxX = base::max(maxX, position.x + getAdvance(curChar));
+            maxY = base::max(maxY, curChar == U'\n' ? position.y + lineSpacing : position.y);
 
             // Next glyph, no need to create a quad for whitespace
             continue;
         }
 
         // Apply the outline
-        if (m_impl->outlineThickness != 0)
+        if (m_impl->outlineThickness != 0 && !isDistanceField)
         {
-            const Glyph& glyph = m_impl->font->getGlyph(curChar, m_impl->characterSize, isBold, m_impl->outlineThickness);
+            const Glyph& glyph = m_impl->font->getGlyph(curChar,
+                                                        m_impl->characterSize,
+                                                        isBold,
+                                                        m_impl->outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_impl->vertices, currOutlineIndex, Vector2f{x, y}, m_impl->outlineColor, glyph, italicShear);
+            addGlyphQuad(m_impl->vertices,
+                         currOutlineIndex,
+                         position,
+                         m_impl->outlineColor,
+                         glyph,
+                         italicShear,
+                         glyphQuadPadding);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_impl->font->getGlyph(curChar, m_impl->characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_impl->vertices, currFillIndex, Vector2f{x, y}, m_impl->fillColor, glyph, italicShear);
+        addGlyphQuad(m_impl->vertices,
+                     currFillIndex,
+                     position,
+                     m_impl->fillColor,
+                     glyph,
+                     italicShear,
+                     glyphQuadPadding);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
         const Vector2f p2 = glyph.bounds.position + glyph.bounds.size;
 
-        minX = base::min(minX, x + p1.x - italicShear * p2.y);
-        maxX = base::max(maxX, x + p2.x - italicShear * p1.y);
-        minY = base::min(minY, y + p1.y);
-        maxY = base::max(maxY, y + p2.y);
-
-        // Advance to the next character
-        x += glyph.advance + letterSpacing;
+        minX = base::min(minX, position.x + p1.x - italicShear * p2.y);
+        maxX = base::max(maxX, position.x + p2.x - italicShear * p1.y);
+        minY = base::min(minY, position.y + p1.y);
+        maxY = base::max(maxY, position.y + p2.y);
     }
 
+    // Save the bounds of the glyphs, so that appended characters can extend them
+    m_impl->glyphsMin = {minX, minY};
+    m_impl->glyphsMax = {maxX, maxY};
+
     // If we're using outline, update the current bounds
     if (m_impl->outlineThickness != 0)
     {
@@ -645,13 +873,46 @@ void Text::ensureGeometryUpdate() const
         maxY += outline;
     }
 
-    // If we're using the underlined style, add the last line
-    if (isUnderlined && (x > 0))
-        addLines(underlineOffset);
+    // If we're using the underlined or strike through style, draw a line across each line of text
+    if (lineQuadCount > 0u)
+    {
+        const auto addLines = [&](const LineMetrics& line, float offset)
+        {
+            const float baseline = line.position.y + characterSize;
+
+            addLine(m_impl->vertices,
+                    currFillIndex,
+                    line.position.x,
+                    line.width,
+                    baseline,
+                    m_impl->fillColor,
+                    offset,
+                    underlineThickness);
+
+            if (m_impl->outlineThickness != 0)
+                addLine(m_impl->vertices,
+                        currOutlineIndex,
+                        line.position.x,
+                        line.width,
+                        baseline,
+                        m_impl->outlineColor,
+                        offset,
+                        underlineThickness,
+                        m_impl->outlineThickness);
+        };
+
+        for (const LineMetrics& line : lines)
+        {
+            if (line.width <= 0.f)
+                continue;
 
-    // If we're using the strike through style, add the last line across all characters
-    if (isStrikeThrough && (x > 0))
-        addLines(strikeThroughOffset);
+            if (isUnderlined)
+                addLines(line, underlineOffset);
+
+            if (isStrikeThrough)
+                addLines(line, strikeThroughOffset);
+        }
+    }
 
     // Update the bounding rectangle
     m_impl->bounds.position = Vector2f{minX, minY};
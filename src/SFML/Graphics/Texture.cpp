@@ -3,9 +3,11 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CompressedImage.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureReadback.hpp"
 #include "SFML/Graphics/TextureSaver.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
@@ -13,6 +15,8 @@
 #include "SFML/Window/Window.hpp"
 
 #include "SFML/System/Err.hpp"
+#include "SFML/System/FileInputStream.hpp"
+#include "SFML/System/InputStream.hpp"
 #include "SFML/System/Path.hpp"
 
 #include "SFML/Base/Algorithm.hpp"
@@ -39,10 +43,237 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+
+////////////////////////////////////////////////////////////
+constexpr std::size_t uploadRingSize = 3u; // Enough to keep a couple of uploads in flight while filling the next one
+
+
+////////////////////////////////////////////////////////////
+// WebGL has no texture swizzle: single-channel textures are stored as
+// white RGBA pixels there, their values being expanded on upload
+#ifdef SFML_SYSTEM_EMSCRIPTEN
+constexpr bool hasSingleChannelStorage = false;
+#else
+constexpr bool hasSingleChannelStorage = true;
+#endif
+
+
+////////////////////////////////////////////////////////////
+/// \brief Expand single-channel values to white RGBA pixels with the values as alpha
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::uint8_t> expandSingleChannel(const std::uint8_t* values, std::size_t count)
+{
+    std::vector<std::uint8_t> pixels(count * 4u, 255u);
+
+    for (std::size_t i = 0u; i < count; ++i)
+        pixels[i * 4u + 3u] = values[i];
+
+    return pixels;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Wait for a fence to be signaled, up to `timeout` nanoseconds
+///
+/// \return Status returned by `glClientWaitSync`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum clientWaitSync(GLsync fence, GLuint64 timeout)
+{
+    // Flush the command queue if needed, otherwise the fence might never be signaled
+    return glCheckExpr(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout));
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Get the OpenGL internal format of a block compressed format
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum getCompressedInternalFormat(sf::priv::CompressedFormat format, bool sRgb)
+{
+    // The linear S3TC formats are only defined by extensions, which the loader doesn't provide
+    constexpr GLenum compressedRgbaS3tcDxt1 = 0x83F1;
+    constexpr GLenum compressedRgbaS3tcDxt3 = 0x83F2;
+    constexpr GLenum compressedRgbaS3tcDxt5 = 0x83F3;
+
+    switch (format)
+    {
+        case sf::priv::CompressedFormat::BC1:
+            return sRgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : compressedRgbaS3tcDxt1;
+        case sf::priv::CompressedFormat::BC2:
+            return sRgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT : compressedRgbaS3tcDxt3;
+        case sf::priv::CompressedFormat::BC3:
+            return sRgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : compressedRgbaS3tcDxt5;
+        case sf::priv::CompressedFormat::ETC2RGB:
+            return sRgb ? GL_COMPRESSED_SRGB8_ETC2 : GL_COMPRESSED_RGB8_ETC2;
+        case sf::priv::CompressedFormat::ETC2RGBA:
+            return sRgb ? GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GL_COMPRESSED_RGBA8_ETC2_EAC;
+    }
+
+    SFML_BASE_ASSERT(false && "Unknown compressed format");
+    return 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the graphics driver can sample a compressed internal format
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCompressedFormatSupported(GLenum internalFormat)
+{
+    const GLint formatCount = sf::priv::getGLInteger(GL_NUM_COMPRESSED_TEXTURE_FORMATS);
+    if (formatCount <= 0)
+        return false;
+
+    std::vector<GLint> formats(static_cast<std::size_t>(formatCount));
+    glCheck(glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data()));
+
+    for (const GLint format : formats)
+        if (static_cast<GLenum>(format) == internalFormat)
+            return true;
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Read a whole stream if it holds a KTX2 or DDS container
+///
+/// \return Container data, or `base::nullOpt` if the stream holds another kind of image
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<std::vector<std::uint8_t>> readCompressedImage(sf::InputStream& stream)
+{
+    sf::base::Optional<std::vector<std::uint8_t>> result; // Use a single local variable for NRVO
+
+    // The magic numbers of the containers fit in the first 12 bytes
+    std::uint8_t header[12]{};
+
+    if (!stream.seek(0).hasValue())
+        return result; // Empty optional
+
+    const sf::base::Optional<std::size_t> headerSize = stream.read(header, sizeof(header));
+    if (!headerSize.hasValue() || !sf::priv::isCompressedImage(header, *headerSize))
+        return result; // Empty optional
+
+    const sf::base::Optional<std::size_t> size = stream.getSize();
+    if (!size.hasValue() || !stream.seek(0).hasValue())
+        return result; // Empty optional
+
+    std::vector<std::uint8_t> data(*size);
+
+    const sf::base::Optional<std::size_t> readSize = stream.read(data.data(), data.size());
+    if (!readSize.hasValue() || (*readSize != data.size()))
+        return result; // Empty optional
+
+    result.emplace(SFML_BASE_MOVE(data));
+    return result;
+}
+
 } // namespace TextureImpl
 } // namespace
 
 
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring of pixel buffer objects used by `Texture::updateAsync`
+///
+/// Each upload is copied to the next buffer of the ring, then
+/// transferred to the texture by the GPU. A fence is inserted
+/// after each transfer, so that the buffer is only overwritten
+/// once the GPU is done reading from it.
+///
+////////////////////////////////////////////////////////////
+struct TextureUploadRing
+{
+    struct Slot
+    {
+        GLuint        buffer{};   //!< Pixel unpack buffer object
+        std::size_t   capacity{}; //!< Size of the buffer storage, in bytes
+        GLsync        fence{};    //!< Signaled once the GPU is done reading from the buffer
+        std::uint64_t sequence{}; //!< Sequence number of the last upload sourced from the buffer
+    };
+
+    ////////////////////////////////////////////////////////////
+    ~TextureUploadRing()
+    {
+        for (Slot& slot : slots)
+        {
+            if (slot.fence != nullptr)
+                glCheck(glDeleteSync(slot.fence));
+
+            if (slot.buffer != 0u)
+                glCheck(glDeleteBuffers(1, &slot.buffer));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the fence of a slot if it has been signaled
+    ///
+    /// \return True if the GPU is done reading from the buffer of the slot
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool retire(Slot& slot, bool block)
+    {
+        if (slot.fence == nullptr)
+            return true;
+
+        const GLuint64 timeout = block ? /* one second */ 1'000'000'000u : 0u;
+
+        // Keep waiting if blocking, the driver might time out long transfers
+        GLenum status = TextureImpl::clientWaitSync(slot.fence, timeout);
+        while (block && status == GL_TIMEOUT_EXPIRED)
+            status = TextureImpl::clientWaitSync(slot.fence, timeout);
+
+        if (status == GL_TIMEOUT_EXPIRED)
+            return false;
+
+        if (status == GL_WAIT_FAILED)
+        {
+            // The fence cannot tell when the transfer is done anymore, wait for all the commands instead
+            priv::err() << "Failed to wait for a texture upload, waiting for all the pending commands instead";
+            glCheck(glFinish());
+        }
+
+        // Commands complete in order, so all the previous uploads are done too
+        completedSequence = base::max(completedSequence, slot.sequence);
+
+        glCheck(glDeleteSync(slot.fence));
+        slot.fence = nullptr;
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the upload with the given sequence number is done
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isComplete(std::uint64_t sequence, bool block)
+    {
+        if (sequence <= completedSequence)
+            return true;
+
+        for (Slot& slot : slots)
+            if (slot.sequence == sequence)
+                return retire(slot, block);
+
+        // The slot has been reused since, which required the upload to be done
+        return true;
+    }
+
+    Slot          slots[TextureImpl::uploadRingSize]; //!< Buffers of the ring
+    std::size_t   nextSlot{};                         //!< Index of the slot used by the next upload
+    std::uint64_t lastSequence{};                     //!< Sequence number of the last upload
+    std::uint64_t completedSequence{};                //!< Sequence number of the last upload known to be done
+    bool          needsFlush{};                       //!< Were uploads issued since the last flush?
+};
+
+} // namespace sf::priv
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -51,12 +282,14 @@ Texture::Texture(base::PassKey<Texture>&&,
                  Vector2u         size,
                  Vector2u         actualSize,
                  unsigned int     texture,
-                 bool             sRgb) :
+                 bool             sRgb,
+                 bool             singleChannel) :
 m_graphicsContext(&graphicsContext),
 m_size(size),
 m_actualSize(actualSize),
 m_texture(texture),
 m_sRgb(sRgb),
+m_singleChannel(singleChannel),
 m_cacheId(TextureImpl::getUniqueId())
 {
 }
@@ -67,10 +300,17 @@ Texture::Texture(const Texture& rhs) :
 m_graphicsContext(rhs.m_graphicsContext),
 m_isSmooth(rhs.m_isSmooth),
 m_sRgb(rhs.m_sRgb),
+m_singleChannel(rhs.m_singleChannel),
 m_isRepeated(rhs.m_isRepeated),
 m_cacheId(TextureImpl::getUniqueId())
 {
-    if (base::Optional texture = create(*m_graphicsContext, rhs.getSize(), rhs.isSrgb()))
+    if (rhs.m_compressed)
+    {
+        priv::err() << "Failed to copy texture, compressed textures cannot be copied";
+        return;
+    }
+
+    if (base::Optional texture = createImpl(*m_graphicsContext, rhs.getSize(), rhs.isSrgb(), rhs.isSingleChannel()))
     {
         *this = SFML_BASE_MOVE(*texture);
         update(rhs);
@@ -103,11 +343,14 @@ m_actualSize(base::exchange(right.m_actualSize, {})),
 m_texture(base::exchange(right.m_texture, 0u)),
 m_isSmooth(base::exchange(right.m_isSmooth, false)),
 m_sRgb(base::exchange(right.m_sRgb, false)),
+m_singleChannel(base::exchange(right.m_singleChannel, false)),
+m_compressed(base::exchange(right.m_compressed, false)),
 m_isRepeated(base::exchange(right.m_isRepeated, false)),
 m_pixelsFlipped(base::exchange(right.m_pixelsFlipped, false)),
 m_fboAttachment(base::exchange(right.m_fboAttachment, false)),
 m_hasMipmap(base::exchange(right.m_hasMipmap, false)),
-m_cacheId(base::exchange(right.m_cacheId, 0u))
+m_cacheId(base::exchange(right.m_cacheId, 0u)),
+m_uploadRing(SFML_BASE_MOVE(right.m_uploadRing))
 {
 }
 
@@ -136,11 +379,14 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_texture         = base::exchange(right.m_texture, 0u);
     m_isSmooth        = base::exchange(right.m_isSmooth, false);
     m_sRgb            = base::exchange(right.m_sRgb, false);
+    m_singleChannel   = base::exchange(right.m_singleChannel, false);
+    m_compressed      = base::exchange(right.m_compressed, false);
     m_isRepeated      = base::exchange(right.m_isRepeated, false);
     m_pixelsFlipped   = base::exchange(right.m_pixelsFlipped, false);
     m_fboAttachment   = base::exchange(right.m_fboAttachment, false);
     m_hasMipmap       = base::exchange(right.m_hasMipmap, false);
     m_cacheId         = base::exchange(right.m_cacheId, 0u);
+    m_uploadRing      = SFML_BASE_MOVE(right.m_uploadRing);
 
     return *this;
 }
@@ -148,6 +394,20 @@ Texture& Texture::operator=(Texture&& right) noexcept
 
 ////////////////////////////////////////////////////////////
 base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector2u size, bool sRgb)
+{
+    return createImpl(graphicsContext, size, sRgb, /* singleChannel */ false);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Texture> Texture::createSingleChannel(GraphicsContext& graphicsContext, Vector2u size)
+{
+    return createImpl(graphicsContext, size, /* sRgb */ false, /* singleChannel */ true);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Texture> Texture::createImpl(GraphicsContext& graphicsContext, Vector2u size, bool sRgb, bool singleChannel)
 {
     base::Optional<Texture> result; // Use a single local variable for NRVO
 
@@ -181,7 +441,7 @@ base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector
     SFML_BASE_ASSERT(glTexture);
 
     // All the validity checks passed, we can store the new texture settings
-    result.emplace(base::PassKey<Texture>{}, graphicsContext, size, actualSize, glTexture, sRgb);
+    result.emplace(base::PassKey<Texture>{}, graphicsContext, size, actualSize, glTexture, sRgb, singleChannel);
     Texture& texture = *result;
 
     // Make sure that the current texture binding will be preserved
@@ -191,15 +451,38 @@ base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector
 
     // Initialize the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
-    glCheck(glTexImage2D(GL_TEXTURE_2D,
-                         0,
-                         (texture.m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
-                         static_cast<GLsizei>(texture.m_actualSize.x),
-                         static_cast<GLsizei>(texture.m_actualSize.y),
-                         0,
-                         GL_RGBA,
-                         GL_UNSIGNED_BYTE,
-                         nullptr));
+
+    if (texture.m_singleChannel && TextureImpl::hasSingleChannelStorage)
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             GL_R8,
+                             static_cast<GLsizei>(texture.m_actualSize.x),
+                             static_cast<GLsizei>(texture.m_actualSize.y),
+                             0,
+                             GL_RED,
+                             GL_UNSIGNED_BYTE,
+                             nullptr));
+
+        // Sample the stored value as the alpha of a white pixel
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+    }
+    else
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             (texture.m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                             static_cast<GLsizei>(texture.m_actualSize.x),
+                             static_cast<GLsizei>(texture.m_actualSize.y),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             nullptr));
+    }
+
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
@@ -215,6 +498,11 @@ base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector
 ////////////////////////////////////////////////////////////
 base::Optional<Texture> Texture::loadFromFile(GraphicsContext& graphicsContext, const Path& filename, bool sRgb, const IntRect& area)
 {
+    // Compressed containers are read as a whole, other formats are decoded by the image loader
+    if (base::Optional stream = FileInputStream::open(filename))
+        if (const base::Optional data = TextureImpl::readCompressedImage(*stream))
+            return loadFromMemory(graphicsContext, data->data(), data->size(), sRgb, area);
+
     if (const base::Optional image = sf::Image::loadFromFile(filename))
         return loadFromImage(graphicsContext, *image, sRgb, area);
 
@@ -231,6 +519,16 @@ base::Optional<Texture> Texture::loadFromMemory(
     bool             sRgb,
     const IntRect&   area)
 {
+    if (priv::isCompressedImage(data, size))
+    {
+        if (const base::Optional compressedImage = priv::parseCompressedImage(data, size))
+            if (base::Optional texture = loadFromCompressedImage(graphicsContext, *compressedImage, sRgb, area))
+                return texture;
+
+        priv::err() << "Failed to load texture from memory";
+        return base::nullOpt;
+    }
+
     if (const base::Optional image = sf::Image::loadFromMemory(data, size))
         return loadFromImage(graphicsContext, *image, sRgb, area);
 
@@ -242,6 +540,9 @@ base::Optional<Texture> Texture::loadFromMemory(
 ////////////////////////////////////////////////////////////
 base::Optional<Texture> Texture::loadFromStream(GraphicsContext& graphicsContext, InputStream& stream, bool sRgb, const IntRect& area)
 {
+    if (const base::Optional data = TextureImpl::readCompressedImage(stream))
+        return loadFromMemory(graphicsContext, data->data(), data->size(), sRgb, area);
+
     if (const base::Optional image = sf::Image::loadFromStream(stream))
         return loadFromImage(graphicsContext, *image, sRgb, area);
 
@@ -312,6 +613,114 @@ base::Optional<Texture> Texture::loadFromImage(GraphicsContext& graphicsContext,
 }
 
 
+////////////////////////////////////////////////////////////
+base::Optional<Texture> Texture::loadFromCompressedImage(GraphicsContext&              graphicsContext,
+                                                         const priv::CompressedImage& compressedImage,
+                                                         bool                         sRgb,
+                                                         const IntRect&               area)
+{
+    base::Optional<Texture> result; // Use a single local variable for NRVO
+
+    SFML_BASE_ASSERT(!compressedImage.levels.empty());
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    const priv::CompressedLevel& baseLevel = compressedImage.levels.front();
+    const auto                   size      = baseLevel.size.to<Vector2i>();
+
+    // Pixels stored as sRGB must be decoded as such, whatever the caller asked for
+    sRgb = sRgb || compressedImage.sRgb;
+
+    const GLenum internalFormat = TextureImpl::getCompressedInternalFormat(compressedImage.format, sRgb);
+
+    const bool wholeImage = (area.size.x == 0) || (area.size.y == 0) ||
+                            ((area.position.x <= 0) && (area.position.y <= 0) && (area.size.x >= size.x) &&
+                             (area.size.y >= size.y));
+
+    const bool padded = (getValidSize(baseLevel.size.x) != baseLevel.size.x) ||
+                        (getValidSize(baseLevel.size.y) != baseLevel.size.y);
+
+    // Upload the blocks as is when the driver can sample them, compressed blocks can't be cropped nor padded
+    if (wholeImage && !padded && TextureImpl::isCompressedFormatSupported(internalFormat))
+    {
+        // Check the maximum texture size
+        const unsigned int maxSize = getMaximumSize(graphicsContext);
+        if ((baseLevel.size.x > maxSize) || (baseLevel.size.y > maxSize))
+        {
+            priv::err() << "Failed to create texture, its internal size is too high "
+                        << "(" << baseLevel.size.x << "x" << baseLevel.size.y << ", "
+                        << "maximum is " << maxSize << "x" << maxSize << ")";
+
+            return result; // Empty optional
+        }
+
+        // Create the OpenGL texture, its storage is specified by the compressed levels only
+        GLuint glTexture = 0;
+        glCheck(glGenTextures(1, &glTexture));
+        SFML_BASE_ASSERT(glTexture);
+
+        result.emplace(base::PassKey<Texture>{},
+                       graphicsContext,
+                       baseLevel.size,
+                       baseLevel.size,
+                       glTexture,
+                       sRgb,
+                       /* singleChannel */ false);
+        result->m_compressed = true;
+
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, result->m_texture));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GLEXT_GL_CLAMP_TO_EDGE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GLEXT_GL_CLAMP_TO_EDGE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+
+        for (std::size_t level = 0u; level < compressedImage.levels.size(); ++level)
+        {
+            const priv::CompressedLevel& compressedLevel = compressedImage.levels[level];
+
+            glCheck(glCompressedTexImage2D(GL_TEXTURE_2D,
+                                           static_cast<GLint>(level),
+                                           internalFormat,
+                                           static_cast<GLsizei>(compressedLevel.size.x),
+                                           static_cast<GLsizei>(compressedLevel.size.y),
+                                           0,
+                                           static_cast<GLsizei>(compressedLevel.byteCount),
+                                           compressedLevel.data));
+        }
+
+        const auto maxLevel = static_cast<GLint>(compressedImage.levels.size() - 1u);
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel));
+
+        // Sample the stored mipmap levels, if any
+        result->m_hasMipmap = maxLevel > 0;
+
+        if (result->m_hasMipmap)
+            glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR));
+
+        // Force an OpenGL flush, so that the texture will appear updated
+        // in all contexts immediately (solves problems in multi-threaded apps)
+        glCheck(glFlush());
+
+        return result;
+    }
+
+    // Fall back to decompressing the largest level on the CPU
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(baseLevel.size.x) * baseLevel.size.y * 4u);
+    priv::decodeCompressedLevel(compressedImage.format, baseLevel, pixels.data());
+
+    const base::Optional image = Image::create(baseLevel.size, pixels.data());
+    if (!image.hasValue())
+    {
+        priv::err() << "Failed to decompress texture";
+        return result; // Empty optional
+    }
+
+    return loadFromImage(graphicsContext, *image, sRgb, area);
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Texture::getSize() const
 {
@@ -324,6 +733,7 @@ Image Texture::copyToImage() const
 {
     // Easy case: empty texture
     SFML_BASE_ASSERT(m_texture && "Texture::copyToImage Cannot copy empty texture to image");
+    SFML_BASE_ASSERT(!m_compressed && "Texture::copyToImage Cannot read back compressed texture");
 
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
@@ -413,12 +823,89 @@ Image Texture::copyToImage() const
 
 #endif // SFML_OPENGL_ES
 
+    if (m_singleChannel && TextureImpl::hasSingleChannelStorage)
+    {
+        // Swizzling doesn't apply to reads, the stored value comes back in the red channel
+        for (std::size_t i = 0; i < pixels.size(); i += 4)
+        {
+            pixels[i + 3] = pixels[i];
+            pixels[i]     = 255;
+            pixels[i + 1] = 255;
+            pixels[i + 2] = 255;
+        }
+    }
+
     auto result = sf::Image::create(m_size, pixels.data());
     SFML_BASE_ASSERT(result.hasValue());
     return SFML_BASE_MOVE(*result);
 }
 
 
+////////////////////////////////////////////////////////////
+TextureReadback Texture::copyToImageAsync() const
+{
+    SFML_BASE_ASSERT(m_texture && "Texture::copyToImageAsync Cannot copy empty texture to image");
+    SFML_BASE_ASSERT(!m_compressed && "Texture::copyToImageAsync Cannot read back compressed texture");
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+#ifdef SFML_SYSTEM_EMSCRIPTEN
+
+    // Buffer mapping is not available on WebGL, read the pixels right away
+    return TextureReadback(base::PassKey<Texture>{}, *m_graphicsContext, copyToImage());
+
+#else
+
+    // Allocate a buffer receiving the visible area of the texture, the padding is never read
+    const std::size_t byteCount = static_cast<std::size_t>(m_size.x) * m_size.y * 4u;
+
+    GLuint buffer = 0;
+    glCheck(glGenBuffers(1, &buffer));
+    glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer));
+    glCheck(glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(byteCount), nullptr, GL_STREAM_READ));
+
+    // Read from the texture through a temporary framebuffer, the data pointer is an offset in the bound buffer
+    GLuint frameBuffer = 0;
+    glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
+    if (frameBuffer)
+    {
+        const auto previousFrameBuffer = priv::getGLInteger(GLEXT_GL_DRAW_FRAMEBUFFER_BINDING);
+
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
+        glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0));
+        glCheck(glReadPixels(0,
+                             0,
+                             static_cast<GLsizei>(m_size.x),
+                             static_cast<GLsizei>(m_size.y),
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             nullptr));
+        glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, static_cast<GLuint>(previousFrameBuffer)));
+    }
+    else
+    {
+        priv::err() << "Failed to create a framebuffer to read back the texture";
+    }
+
+    glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    // The pixels can be taken once the GPU has executed the commands above
+    GLsync const fence = glCheckExpr(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    return TextureReadback(base::PassKey<Texture>{},
+                           *m_graphicsContext,
+                           buffer,
+                           fence,
+                           m_size,
+                           m_pixelsFlipped,
+                           m_singleChannel);
+
+#endif // SFML_SYSTEM_EMSCRIPTEN
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels)
 {
@@ -436,6 +923,7 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
     SFML_BASE_ASSERT(pixels != nullptr);
 
     SFML_BASE_ASSERT(m_texture);
+    SFML_BASE_ASSERT(!m_compressed && "Compressed textures cannot be updated");
     SFML_BASE_ASSERT(glCheckExpr(glIsTexture(m_texture)));
 
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
@@ -443,6 +931,20 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
     // Make sure that the current texture binding will be preserved
     const priv::TextureSaver save;
 
+    const bool singleChannelUpload = m_singleChannel && TextureImpl::hasSingleChannelStorage;
+
+    // Single-channel values are expanded if the texture is stored as RGBA
+    std::vector<std::uint8_t> expandedPixels;
+    if (m_singleChannel && !singleChannelUpload)
+    {
+        expandedPixels = TextureImpl::expandSingleChannel(pixels, static_cast<std::size_t>(size.x) * size.y);
+        pixels         = expandedPixels.data();
+    }
+
+    // Rows of single-channel pixels are tightly packed, whatever their width
+    if (singleChannelUpload)
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
     // Copy pixels from the given array to the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
     glCheck(glTexSubImage2D(GL_TEXTURE_2D,
@@ -451,9 +953,12 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
                             static_cast<GLint>(dest.y),
                             static_cast<GLsizei>(size.x),
                             static_cast<GLsizei>(size.y),
-                            GL_RGBA,
+                            singleChannelUpload ? GL_RED : GL_RGBA,
                             GL_UNSIGNED_BYTE,
                             pixels));
+
+    if (singleChannelUpload)
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_hasMipmap     = false;
     m_pixelsFlipped = false;
@@ -465,6 +970,158 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
 }
 
 
+////////////////////////////////////////////////////////////
+Texture::UploadTicket Texture::updateAsync(const std::uint8_t* pixels)
+{
+    // Update the whole texture
+    return updateAsync(pixels, m_size, {0, 0});
+}
+
+
+////////////////////////////////////////////////////////////
+Texture::UploadTicket Texture::updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    SFML_BASE_ASSERT(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    SFML_BASE_ASSERT(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+
+    SFML_BASE_ASSERT(pixels != nullptr);
+
+    SFML_BASE_ASSERT(m_texture);
+    SFML_BASE_ASSERT(!m_compressed && "Compressed textures cannot be updated");
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    if (m_uploadRing == nullptr)
+        m_uploadRing = base::makeUnique<priv::TextureUploadRing>();
+
+    priv::TextureUploadRing&       ring = *m_uploadRing;
+    priv::TextureUploadRing::Slot& slot = ring.slots[ring.nextSlot];
+
+    ring.nextSlot = (ring.nextSlot + 1u) % TextureImpl::uploadRingSize;
+
+    // Wait until the GPU is done with the previous upload sourced from this buffer,
+    // which only blocks if all the buffers of the ring are still in flight
+    [[maybe_unused]] const bool retired = ring.retire(slot, /* block */ true);
+
+    const bool        singleChannelUpload = m_singleChannel && TextureImpl::hasSingleChannelStorage;
+    const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y * (singleChannelUpload ? 1u : 4u);
+
+    // Single-channel values are expanded if the texture is stored as RGBA
+    std::vector<std::uint8_t> expandedPixels;
+    if (m_singleChannel && !singleChannelUpload)
+    {
+        expandedPixels = TextureImpl::expandSingleChannel(pixels, static_cast<std::size_t>(size.x) * size.y);
+        pixels         = expandedPixels.data();
+    }
+
+    if (slot.buffer == 0u)
+        glCheck(glGenBuffers(1, &slot.buffer));
+
+    glCheck(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer));
+
+    if (slot.capacity < byteCount)
+    {
+        glCheck(glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(byteCount), nullptr, GL_STREAM_DRAW));
+        slot.capacity = byteCount;
+    }
+
+#ifdef SFML_SYSTEM_EMSCRIPTEN
+    // Buffer mapping is not available on WebGL
+    glCheck(glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(byteCount), pixels));
+#else
+    // The GPU is not reading from the buffer anymore, no need to synchronize
+    void* const mapped = glCheckExpr(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                                                      0,
+                                                      static_cast<GLsizeiptr>(byteCount),
+                                                      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                                                          GL_MAP_UNSYNCHRONIZED_BIT));
+
+    if (mapped != nullptr)
+    {
+        std::memcpy(mapped, pixels, byteCount);
+        [[maybe_unused]] const GLboolean unmapped = glCheckExpr(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+    }
+    else
+    {
+        glCheck(glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(byteCount), pixels));
+    }
+#endif
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    // Rows of single-channel pixels are tightly packed, whatever their width
+    if (singleChannelUpload)
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+    // Transfer the pixels from the bound buffer to the texture, the data pointer is an offset in the buffer
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            static_cast<GLint>(dest.x),
+                            static_cast<GLint>(dest.y),
+                            static_cast<GLsizei>(size.x),
+                            static_cast<GLsizei>(size.y),
+                            singleChannelUpload ? GL_RED : GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            nullptr));
+
+    if (singleChannelUpload)
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+    glCheck(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+    // No flush here: the fence is flushed by whoever waits for it
+    slot.fence      = glCheckExpr(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    slot.sequence   = ++ring.lastSequence;
+    ring.needsFlush = true;
+
+    // The minifying filter only needs to be reset if it was sampling the mipmap
+    if (m_hasMipmap)
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+
+    m_hasMipmap     = false;
+    m_pixelsFlipped = false;
+    m_cacheId       = TextureImpl::getUniqueId();
+
+    return UploadTicket{slot.sequence};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isUploadComplete(UploadTicket ticket) const
+{
+    if (m_uploadRing == nullptr)
+        return true;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    return m_uploadRing->isComplete(ticket.sequence, /* block */ false);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::waitForUpload(UploadTicket ticket) const
+{
+    if (m_uploadRing == nullptr)
+        return;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    [[maybe_unused]] const bool complete = m_uploadRing->isComplete(ticket.sequence, /* block */ true);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::flushUploads()
+{
+    if ((m_uploadRing == nullptr) || !m_uploadRing->needsFlush)
+        return;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    glCheck(glFlush());
+    m_uploadRing->needsFlush = false;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::update(const Texture& texture)
 {
@@ -481,9 +1138,11 @@ void Texture::update(const Texture& texture, Vector2u dest)
 
     SFML_BASE_ASSERT(m_texture);
     SFML_BASE_ASSERT(glCheckExpr(glIsTexture(m_texture)));
+    SFML_BASE_ASSERT(!m_compressed && "Compressed textures cannot be updated");
 
     SFML_BASE_ASSERT(texture.m_texture);
     SFML_BASE_ASSERT(glCheckExpr(glIsTexture(texture.m_texture)));
+    SFML_BASE_ASSERT(!texture.m_compressed && "Compressed textures cannot be copied");
 
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
@@ -589,14 +1248,28 @@ void Texture::update(const Texture& texture, Vector2u dest)
 void Texture::update(const Image& image)
 {
     // Update the whole texture
-    update(image.getPixelsPtr(), image.getSize(), {0u, 0u});
+    update(image, {0u, 0u});
 }
 
 
 ////////////////////////////////////////////////////////////
 void Texture::update(const Image& image, Vector2u dest)
 {
-    update(image.getPixelsPtr(), image.getSize(), dest);
+    if (!m_singleChannel)
+    {
+        update(image.getPixelsPtr(), image.getSize(), dest);
+        return;
+    }
+
+    // Keep only the alpha channel of the image
+    const std::size_t         pixelCount = static_cast<std::size_t>(image.getSize().x) * image.getSize().y;
+    const std::uint8_t*       src        = image.getPixelsPtr();
+    std::vector<std::uint8_t> alphas(pixelCount);
+
+    for (std::size_t i = 0; i < pixelCount; ++i)
+        alphas[i] = src[i * 4 + 3];
+
+    update(alphas.data(), image.getSize(), dest);
 }
 
 
@@ -615,6 +1288,7 @@ bool Texture::update(const Window& window, Vector2u dest)
 
     SFML_BASE_ASSERT(m_texture);
     SFML_BASE_ASSERT(glCheckExpr(glIsTexture(m_texture)));
+    SFML_BASE_ASSERT(!m_compressed && "Compressed textures cannot be updated");
 
     if (!window.setActive(true))
     {
@@ -781,6 +1455,13 @@ bool Texture::isSrgb() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::isSingleChannel() const
+{
+    return m_singleChannel;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::setRepeated(bool repeated)
 {
@@ -847,6 +1528,13 @@ bool Texture::generateMipmap()
         return false;
     }
 
+    // Compressed textures keep the mipmap levels they were loaded with
+    if (m_compressed)
+    {
+        priv::err() << "Could not generate mipmap, the texture holds compressed pixels";
+        return false;
+    }
+
     // Make sure that the current texture binding will be preserved
     const priv::TextureSaver save;
 
@@ -944,11 +1632,14 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_texture, right.m_texture);
     std::swap(m_isSmooth, right.m_isSmooth);
     std::swap(m_sRgb, right.m_sRgb);
+    std::swap(m_singleChannel, right.m_singleChannel);
+    std::swap(m_compressed, right.m_compressed);
     std::swap(m_isRepeated, right.m_isRepeated);
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
     std::swap(m_cacheId, right.m_cacheId);
+    std::swap(m_uploadRing, right.m_uploadRing);
 }
 
 
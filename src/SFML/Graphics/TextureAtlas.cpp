@@ -0,0 +1,259 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RectPacker.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureAtlas.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+#include <vector>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureAtlas::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct Page
+    {
+        Texture    texture; //!< Texture containing the pixels of the images
+        RectPacker packer;  //!< Allocator of the texture area
+    };
+
+    explicit Impl(GraphicsContext& theGraphicsContext, Vector2u theInitialPageSize, unsigned int thePadding, unsigned int theExtrusion) :
+    graphicsContext(&theGraphicsContext),
+    initialPageSize(theInitialPageSize),
+    padding(thePadding),
+    extrusion(theExtrusion)
+    {
+    }
+
+    GraphicsContext*                   graphicsContext; //!< The window context
+    Vector2u                           initialPageSize; //!< Size of newly created pages
+    unsigned int                       padding;         //!< Gap between two images
+    unsigned int                       extrusion;       //!< Width of the repeated border around each image
+    bool                               isSmooth{};      //!< Status of the smooth filter
+    std::vector<base::UniquePtr<Page>> pages; //!< Pages of the atlas (heap allocated so that textures never move)
+    std::vector<std::uint8_t> pixelBuffer; //!< Pixel buffer holding an extruded image before being written to a page
+};
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(base::PassKey<TextureAtlas>&&,
+                           GraphicsContext& graphicsContext,
+                           Vector2u         initialPageSize,
+                           unsigned int     padding,
+                           unsigned int     extrusion) :
+m_impl(graphicsContext, initialPageSize, padding, extrusion)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas& TextureAtlas::operator=(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+base::Optional<TextureAtlas> TextureAtlas::create(GraphicsContext& graphicsContext,
+                                                  Vector2u         initialPageSize,
+                                                  unsigned int     padding,
+                                                  unsigned int     extrusion)
+{
+    const unsigned int maxSize = Texture::getMaximumSize(graphicsContext);
+
+    if (initialPageSize.x == 0u || initialPageSize.y == 0u || initialPageSize.x > maxSize || initialPageSize.y > maxSize)
+    {
+        priv::err() << "Failed to create texture atlas, invalid page size (" << initialPageSize.x << "x"
+                    << initialPageSize.y << ", maximum is " << maxSize << ")";
+
+        return base::nullOpt;
+    }
+
+    return base::makeOptional<TextureAtlas>(base::PassKey<TextureAtlas>{}, graphicsContext, initialPageSize, padding, extrusion);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<TextureAtlas::Entry> TextureAtlas::add(const Image& image)
+{
+    return add(image.getPixelsPtr(), image.getSize());
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<TextureAtlas::Entry> TextureAtlas::add(const std::uint8_t* pixels, Vector2u size)
+{
+    if (pixels == nullptr || size.x == 0u || size.y == 0u)
+    {
+        priv::err() << "Failed to add image to texture atlas, the image is empty";
+        return base::nullOpt;
+    }
+
+    GraphicsContext&   graphicsContext = *m_impl->graphicsContext;
+    const unsigned int maxSize         = Texture::getMaximumSize(graphicsContext);
+
+    // Extruded borders surround the image, padding separates it from the next images
+    const Vector2u extrudedSize = size + Vector2u{m_impl->extrusion, m_impl->extrusion} * 2u;
+    const Vector2u slotSize     = extrudedSize + Vector2u{m_impl->padding, m_impl->padding};
+
+    if (slotSize.x > maxSize || slotSize.y > maxSize)
+    {
+        priv::err() << "Failed to add image to texture atlas, the image is larger than the maximum texture size ("
+                    << maxSize << ")";
+
+        return base::nullOpt;
+    }
+
+    // Find room in the existing pages, growing them if needed
+    const auto allocate = [&](Impl::Page& page) -> base::Optional<Vector2u>
+    {
+        while (true)
+        {
+            if (const base::Optional position = page.packer.pack(slotSize))
+                return position;
+
+            const Vector2u textureSize = page.texture.getSize();
+            if (textureSize.x * 2u > maxSize || textureSize.y * 2u > maxSize)
+                return base::nullOpt;
+
+            // Not enough space: make the texture 2 times bigger, transparent outside of the copied page
+            auto newTexture = Texture::loadFromImage(graphicsContext,
+                                                     *Image::create(textureSize * 2u, Color::Transparent));
+            if (!newTexture.hasValue())
+            {
+                priv::err() << "Failed to create new texture atlas page texture";
+                return base::nullOpt;
+            }
+
+            newTexture->setSmooth(m_impl->isSmooth);
+            newTexture->update(page.texture);
+            page.texture.swap(*newTexture);
+            page.packer.grow(textureSize * 2u);
+        }
+    };
+
+    std::size_t              pageIndex = 0u;
+    base::Optional<Vector2u> position;
+
+    for (; pageIndex < m_impl->pages.size(); ++pageIndex)
+        if ((position = allocate(*m_impl->pages[pageIndex])).hasValue())
+            break;
+
+    if (!position.hasValue())
+    {
+        // Every page is full: open a new one, large enough to hold the image
+        Vector2u pageSize = m_impl->initialPageSize;
+        while (pageSize.x < slotSize.x)
+            pageSize.x = base::min(pageSize.x * 2u, maxSize);
+        while (pageSize.y < slotSize.y)
+            pageSize.y = base::min(pageSize.y * 2u, maxSize);
+
+        // Make sure that the texture is initialized by default
+        auto texture = Texture::loadFromImage(graphicsContext, *Image::create(pageSize, Color::Transparent));
+        if (!texture.hasValue())
+        {
+            priv::err() << "Failed to create texture atlas page texture";
+            return base::nullOpt;
+        }
+
+        texture->setSmooth(m_impl->isSmooth);
+        m_impl->pages.push_back(base::makeUnique<Impl::Page>(SFML_BASE_MOVE(*texture), RectPacker{pageSize}));
+
+        pageIndex = m_impl->pages.size() - 1u;
+        position  = allocate(*m_impl->pages.back());
+
+        SFML_BASE_ASSERT(position.hasValue());
+    }
+
+    Texture& texture = m_impl->pages[pageIndex]->texture;
+
+    if (m_impl->extrusion == 0u)
+    {
+        texture.update(pixels, size, *position);
+    }
+    else
+    {
+        // Repeat the border pixels of the image over the extruded area
+        m_impl->pixelBuffer.resize(static_cast<std::size_t>(extrudedSize.x) * extrudedSize.y * 4u);
+        std::uint8_t* current = m_impl->pixelBuffer.data();
+
+        for (unsigned int y = 0u; y < extrudedSize.y; ++y)
+        {
+            const unsigned int  sourceY   = base::clamp(y, m_impl->extrusion, m_impl->extrusion + size.y - 1u) - m_impl->extrusion;
+            const std::uint8_t* sourceRow = pixels + static_cast<std::size_t>(sourceY) * size.x * 4u;
+
+            for (unsigned int x = 0u; x < m_impl->extrusion; ++x, current += 4)
+                std::memcpy(current, sourceRow, 4u);
+
+            std::memcpy(current, sourceRow, static_cast<std::size_t>(size.x) * 4u);
+            current += static_cast<std::size_t>(size.x) * 4u;
+
+            for (unsigned int x = 0u; x < m_impl->extrusion; ++x, current += 4)
+                std::memcpy(current, sourceRow + (size.x - 1u) * 4u, 4u);
+        }
+
+        texture.update(m_impl->pixelBuffer.data(), extrudedSize, *position);
+    }
+
+    return base::makeOptional<Entry>(pageIndex,
+                                     IntRect{(*position + Vector2u{m_impl->extrusion, m_impl->extrusion}).to<Vector2i>(),
+                                             size.to<Vector2i>()});
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(std::size_t pageIndex) const
+{
+    SFML_BASE_ASSERT(pageIndex < m_impl->pages.size() && "Texture atlas page index out of range");
+    return m_impl->pages[pageIndex]->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_impl->pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    if (smooth == m_impl->isSmooth)
+        return;
+
+    m_impl->isSmooth = smooth;
+
+    for (const base::UniquePtr<Impl::Page>& page : m_impl->pages)
+        page->texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isSmooth() const
+{
+    return m_impl->isSmooth;
+}
+
+} // namespace sf
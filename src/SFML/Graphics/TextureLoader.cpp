@@ -0,0 +1,327 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CompressedImage.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureLoader.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Err.hpp"
+#include "SFML/System/FileInputStream.hpp"
+#include "SFML/System/Path.hpp"
+#include "SFML/System/PathUtils.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureLoaderImpl
+{
+////////////////////////////////////////////////////////////
+constexpr std::size_t maxDecodedImagesPerThread = 4u; // Bounds the memory held by images waiting for their upload
+
+} // namespace TextureLoaderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureLoader::Impl
+{
+    struct Request
+    {
+        std::size_t index;    //!< Index of the texture
+        Path        filename; //!< Path of the image file to load
+        bool        sRgb;     //!< Enable sRGB conversion?
+    };
+
+    struct Decoded
+    {
+        std::size_t               index;          //!< Index of the texture
+        bool                      sRgb;           //!< Enable sRGB conversion?
+        base::Optional<Image>     image;          //!< Decoded pixels, if the file is a regular image
+        std::vector<std::uint8_t> compressedData; //!< Contents of the file, if it is a KTX2 or DDS container
+    };
+
+    explicit Impl(GraphicsContext& theGraphicsContext, unsigned int threadCount) :
+    graphicsContext(&theGraphicsContext),
+    maxDecodedCount(threadCount * TextureLoaderImpl::maxDecodedImagesPerThread)
+    {
+        workers.reserve(threadCount);
+
+        for (unsigned int i = 0u; i < threadCount; ++i)
+            workers.emplace_back([this] { runWorker(); });
+    }
+
+    ~Impl()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        condition.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    void runWorker()
+    {
+        while (true)
+        {
+            base::Optional<Request> request;
+
+            {
+                std::unique_lock lock(mutex);
+
+                // Wait for a request, unless too many decoded images already wait for their upload
+                condition.wait(lock,
+                               [this]
+                               {
+                                   return stopping || ((nextRequest < requests.size()) &&
+                                                       (decoded.size() + decodingCount < maxDecodedCount));
+                               });
+
+                if (stopping)
+                    return;
+
+                request.emplace(SFML_BASE_MOVE(requests[nextRequest++]));
+                ++decodingCount;
+            }
+
+            Decoded result = decode(*request);
+
+            const std::lock_guard lock(mutex);
+            decoded.push_back(SFML_BASE_MOVE(result));
+            --decodingCount;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Decoded decode(const Request& request)
+    {
+        Decoded result{request.index, request.sRgb, base::nullOpt, {}};
+
+        // Read the whole file, the I/O is spread over the worker threads too
+        base::Optional<FileInputStream> stream = FileInputStream::open(request.filename);
+        base::Optional<std::size_t>     size   = stream.hasValue() ? stream->getSize() : base::nullOpt;
+
+        std::vector<std::uint8_t> data(size.hasValue() ? *size : 0u);
+
+        if (!size.hasValue() || (stream->read(data.data(), data.size()) != base::makeOptional(data.size())))
+        {
+            priv::err() << "Failed to read texture file\n"
+                        << "Path: " << priv::PathDebugFormatter{request.filename};
+
+            return result;
+        }
+
+        // Compressed containers are uploaded as is, there is nothing to decode
+        if (priv::isCompressedImage(data.data(), data.size()))
+        {
+            result.compressedData = SFML_BASE_MOVE(data);
+            return result;
+        }
+
+        result.image = Image::loadFromMemory(data.data(), data.size());
+        return result;
+    }
+
+    GraphicsContext*  graphicsContext; //!< Context in which the textures are created
+    const std::size_t maxDecodedCount; //!< Maximum number of decoded images waiting for their upload
+
+    std::mutex              mutex;           //!< Mutex protecting the queues below
+    std::condition_variable condition;       //!< Wakes up the workers when a request is added or an image is taken
+    std::vector<Request>    requests;        //!< Files to decode, in order
+    std::size_t             nextRequest{};   //!< Index of the next request to pick up
+    std::vector<Decoded>    decoded;         //!< Images waiting for their upload, in decoding order
+    std::size_t             decodingCount{}; //!< Number of images being decoded
+    bool                    stopping{};      //!< Should the workers stop?
+
+    std::vector<base::Optional<Texture>> textures;           //!< Loaded textures, by index
+    std::vector<Status>                  statuses;           //!< States of the textures, by index
+    std::size_t                          processedCount{};   //!< Number of textures loaded or failed
+    std::size_t                          failedCount{};      //!< Number of textures that failed to load
+    ProgressCallback                     progressCallback;   //!< Called after each processed texture
+    CompletionCallback                   completionCallback; //!< Called once all the textures are processed
+
+    std::vector<std::thread> workers; //!< Worker threads, started last
+};
+
+
+////////////////////////////////////////////////////////////
+TextureLoader::TextureLoader(GraphicsContext& graphicsContext, unsigned int threadCount) :
+m_impl(base::makeUnique<Impl>(graphicsContext,
+                              threadCount == 0u ? base::max(std::thread::hardware_concurrency(), 1u) : threadCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureLoader::~TextureLoader() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureLoader::TextureLoader(TextureLoader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureLoader& TextureLoader::operator=(TextureLoader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureLoader::enqueue(const Path& filename, bool sRgb)
+{
+    const std::size_t index = m_impl->statuses.size();
+
+    m_impl->statuses.push_back(Status::Pending);
+    m_impl->textures.emplace_back();
+
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->requests.push_back({index, filename, sRgb});
+    }
+
+    m_impl->condition.notify_one();
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureLoader::update(Time timeBudget)
+{
+    SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    const Clock clock;
+    std::size_t processed = 0u;
+
+    // Make some progress even with a tiny budget
+    while ((processed == 0u) || (clock.getElapsedTime() < timeBudget))
+    {
+        base::Optional<Impl::Decoded> item;
+
+        {
+            const std::lock_guard lock(m_impl->mutex);
+
+            if (m_impl->decoded.empty())
+                break;
+
+            item.emplace(SFML_BASE_MOVE(m_impl->decoded.front()));
+            m_impl->decoded.erase(m_impl->decoded.begin());
+        }
+
+        // A worker might be waiting for room to decode its next image
+        m_impl->condition.notify_all();
+
+        base::Optional<Texture> texture;
+
+        if (item->image.hasValue())
+            texture = Texture::loadFromImage(*m_impl->graphicsContext, *item->image, item->sRgb);
+        else if (!item->compressedData.empty())
+            texture = Texture::loadFromMemory(*m_impl->graphicsContext,
+                                              item->compressedData.data(),
+                                              item->compressedData.size(),
+                                              item->sRgb);
+
+        m_impl->statuses[item->index] = texture.hasValue() ? Status::Loaded : Status::Failed;
+        m_impl->failedCount += texture.hasValue() ? 0u : 1u;
+        m_impl->textures[item->index] = SFML_BASE_MOVE(texture);
+
+        ++m_impl->processedCount;
+        ++processed;
+
+        if (m_impl->progressCallback)
+            m_impl->progressCallback(m_impl->processedCount, m_impl->statuses.size());
+    }
+
+    if ((processed > 0u) && isFinished() && m_impl->completionCallback)
+        m_impl->completionCallback(m_impl->failedCount);
+
+    return processed;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureLoader::Status TextureLoader::getStatus(std::size_t index) const
+{
+    SFML_BASE_ASSERT(index < m_impl->statuses.size());
+    return m_impl->statuses[index];
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Texture> TextureLoader::takeTexture(std::size_t index)
+{
+    SFML_BASE_ASSERT(index < m_impl->statuses.size());
+
+    base::Optional<Texture> result; // Use a single local variable for NRVO
+
+    if (m_impl->statuses[index] != Status::Loaded)
+        return result; // Empty optional
+
+    result = SFML_BASE_MOVE(m_impl->textures[index]);
+    m_impl->textures[index].reset();
+    m_impl->statuses[index] = Status::Taken;
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureLoader::getProcessedCount() const
+{
+    return m_impl->processedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureLoader::getTotalCount() const
+{
+    return m_impl->statuses.size();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureLoader::isFinished() const
+{
+    return m_impl->processedCount == m_impl->statuses.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureLoader::setProgressCallback(ProgressCallback callback)
+{
+    m_impl->progressCallback = SFML_BASE_MOVE(callback);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureLoader::setCompletionCallback(CompletionCallback callback)
+{
+    m_impl->completionCallback = SFML_BASE_MOVE(callback);
+}
+
+} // namespace sf
@@ -0,0 +1,227 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/TextureReadback.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(base::PassKey<Texture>&&,
+                                 GraphicsContext& graphicsContext,
+                                 unsigned int     buffer,
+                                 void*            fence,
+                                 Vector2u         size,
+                                 bool             flipped,
+                                 bool             singleChannel) :
+m_graphicsContext(&graphicsContext),
+m_buffer(buffer),
+m_fence(fence),
+m_size(size),
+m_flipped(flipped),
+m_singleChannel(singleChannel)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(base::PassKey<Texture>&&, GraphicsContext& graphicsContext, Image&& image) :
+m_graphicsContext(&graphicsContext),
+m_size(image.getSize()),
+m_image(SFML_BASE_MOVE(image))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::~TextureReadback()
+{
+    release();
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(TextureReadback&& right) noexcept :
+m_graphicsContext(right.m_graphicsContext),
+m_buffer(base::exchange(right.m_buffer, 0u)),
+m_fence(base::exchange(right.m_fence, nullptr)),
+m_size(right.m_size),
+m_flipped(right.m_flipped),
+m_singleChannel(right.m_singleChannel),
+m_image(SFML_BASE_MOVE(right.m_image))
+{
+    right.m_image.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback& TextureReadback::operator=(TextureReadback&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    release();
+
+    m_graphicsContext = right.m_graphicsContext;
+    m_buffer          = base::exchange(right.m_buffer, 0u);
+    m_fence           = base::exchange(right.m_fence, nullptr);
+    m_size            = right.m_size;
+    m_flipped         = right.m_flipped;
+    m_singleChannel   = right.m_singleChannel;
+    m_image           = SFML_BASE_MOVE(right.m_image);
+
+    right.m_image.reset();
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isReady() const
+{
+    if (m_fence == nullptr)
+        return true;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Flush the command queue if needed, otherwise the fence might never be signaled
+    const GLenum status = glCheckExpr(glClientWaitSync(static_cast<GLsync>(m_fence), GL_SYNC_FLUSH_COMMANDS_BIT, 0u));
+    return (status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Image> TextureReadback::takeImage()
+{
+    base::Optional<Image> result; // Use a single local variable for NRVO
+
+    if (m_image.hasValue())
+    {
+        result = SFML_BASE_MOVE(m_image);
+        m_image.reset();
+        return result;
+    }
+
+    if (m_buffer == 0u)
+    {
+        priv::err() << "Failed to take the image of a texture readback, it was already taken";
+        return result; // Empty optional
+    }
+
+#ifdef SFML_SYSTEM_EMSCRIPTEN
+
+    // Buffer mapping is not available on WebGL, the pixels were read synchronously
+    SFML_BASE_ASSERT(false && "Texture readbacks never use pixel buffers on WebGL");
+    return result; // Empty optional
+
+#else
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Wait for the GPU to be done writing the pixels to the buffer, the mapping below would do it anyway
+    GLenum status = GL_TIMEOUT_EXPIRED;
+    while (status == GL_TIMEOUT_EXPIRED)
+        status = glCheckExpr(glClientWaitSync(static_cast<GLsync>(m_fence),
+                                              GL_SYNC_FLUSH_COMMANDS_BIT,
+                                              /* one second */ 1'000'000'000u));
+
+    const std::size_t rowSize   = static_cast<std::size_t>(m_size.x) * 4u;
+    const std::size_t byteCount = rowSize * m_size.y;
+
+    glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, m_buffer));
+
+    const auto* const mapped = static_cast<const std::uint8_t*>(
+        glCheckExpr(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(byteCount), GL_MAP_READ_BIT)));
+
+    if (mapped == nullptr)
+    {
+        priv::err() << "Failed to take the image of a texture readback, the pixel buffer could not be mapped";
+
+        glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+        release();
+        return result; // Empty optional
+    }
+
+    result = Image::create(m_size);
+    SFML_BASE_ASSERT(result.hasValue());
+
+    // Copy the rows straight to the image, flipping them on the way if needed
+    std::uint8_t* const pixels = result->getMutablePixelsPtr();
+
+    for (unsigned int y = 0; y < m_size.y; ++y)
+    {
+        const std::uint8_t* src = mapped + (m_flipped ? m_size.y - 1u - y : y) * rowSize;
+        std::uint8_t*       dst = pixels + y * rowSize;
+
+        if (!m_singleChannel)
+        {
+            std::memcpy(dst, src, rowSize);
+            continue;
+        }
+
+        // Swizzling doesn't apply to reads, the stored value comes back in the red channel
+        for (std::size_t i = 0; i < rowSize; i += 4)
+        {
+            dst[i]     = 255;
+            dst[i + 1] = 255;
+            dst[i + 2] = 255;
+            dst[i + 3] = src[i];
+        }
+    }
+
+    [[maybe_unused]] const GLboolean unmapped = glCheckExpr(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+    glCheck(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    // The buffer is not needed anymore
+    release();
+
+    return result;
+
+#endif // SFML_SYSTEM_EMSCRIPTEN
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureReadback::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureReadback::release()
+{
+    if ((m_buffer == 0u) && (m_fence == nullptr))
+        return;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    if (m_fence != nullptr)
+        glCheck(glDeleteSync(static_cast<GLsync>(m_fence)));
+
+    if (m_buffer != 0u)
+        glCheck(glDeleteBuffers(1, &m_buffer));
+
+    m_fence  = nullptr;
+    m_buffer = 0u;
+}
+
+} // namespace sf
@@ -0,0 +1,146 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/UniformBuffer.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(GraphicsContext& graphicsContext) : m_graphicsContext(&graphicsContext)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+        glCheck(glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(UniformBuffer&& right) noexcept :
+m_graphicsContext(right.m_graphicsContext),
+m_buffer(base::exchange(right.m_buffer, 0u)),
+m_size(base::exchange(right.m_size, 0u))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(UniformBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+        glCheck(glDeleteBuffers(1, &m_buffer));
+    }
+
+    m_graphicsContext = right.m_graphicsContext;
+    m_buffer          = base::exchange(right.m_buffer, 0u);
+    m_size            = base::exchange(right.m_size, 0u);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::create(std::size_t byteCount)
+{
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    if (!m_buffer)
+        glCheck(glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        priv::err() << "Could not create uniform buffer, generation failed";
+        return false;
+    }
+
+    // Use the generic copy-write target, the uniform buffer bindings are left untouched
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+    glCheck(glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(byteCount), nullptr, GL_DYNAMIC_DRAW));
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+
+    m_size = byteCount;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t byteCount, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!data)
+        return false;
+
+    if (offset + byteCount > m_size)
+        return false;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+    glCheck(glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(offset),
+                            static_cast<GLsizeiptr>(byteCount),
+                            data));
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::bind([[maybe_unused]] GraphicsContext& graphicsContext,
+                         const UniformBuffer*              uniformBuffer,
+                         unsigned int                      bindingPoint)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    glCheck(glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, uniformBuffer ? uniformBuffer->m_buffer : 0));
+}
+
+} // namespace sf
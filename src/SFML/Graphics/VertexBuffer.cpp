@@ -123,12 +123,13 @@ bool VertexBuffer::create(std::size_t vertexCount)
         return false;
     }
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
-    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                               nullptr,
-                               VertexBufferImpl::usageToGlEnum(m_usage)));
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    // Use the generic copy-write target, render targets keep track of the array buffer binding
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+    glCheck(glBufferData(GL_COPY_WRITE_BUFFER,
+                         static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                         nullptr,
+                         VertexBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
 
     m_size = vertexCount;
 
@@ -165,25 +166,26 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    // Use the generic copy-write target, render targets keep track of the array buffer binding
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
 
     // Check if we need to resize or orphan the buffer
     if (vertexCount >= m_size)
     {
-        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                   nullptr,
-                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+        glCheck(glBufferData(GL_COPY_WRITE_BUFFER,
+                             static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                             nullptr,
+                             VertexBufferImpl::usageToGlEnum(m_usage)));
 
         m_size = vertexCount;
     }
 
-    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                  vertices));
+    glCheck(glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(sizeof(Vertex) * offset),
+                            static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                            vertices));
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
 
     return true;
 }
@@ -214,6 +216,10 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
         return true;
     }
 
+    // Render targets keep track of the array buffer binding, restore it once done
+    GLint previousBuffer = 0;
+    glCheck(glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &previousBuffer));
+
     glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_buffer));
     glCheck(glBufferData(GL_ARRAY_BUFFER,
                          static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
@@ -238,7 +244,7 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     GLboolean destinationResult = GL_FALSE;
     glCheck(destinationResult = glUnmapBuffer(GL_ARRAY_BUFFER));
 
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(previousBuffer)));
 
     return (sourceResult == GL_TRUE) && (destinationResult == GL_TRUE);
 }
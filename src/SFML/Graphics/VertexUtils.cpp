@@ -0,0 +1,220 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexUtils.hpp"
+
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_PRIV_VERTEX_UTILS_SSE2
+#include <emmintrin.h>
+
+// Runtime dispatch to AVX2 relies on function multiversioning attributes
+#if defined(__GNUC__) || defined(__clang__)
+#define SFML_PRIV_VERTEX_UTILS_AVX2
+#include <immintrin.h>
+#endif
+
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SFML_PRIV_VERTEX_UTILS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace VertexUtilsImpl
+{
+////////////////////////////////////////////////////////////
+struct AffineMatrix
+{
+    float a00, a01, a02; //!< First row of the matrix
+    float a10, a11, a12; //!< Second row of the matrix
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] AffineMatrix toAffineMatrix(const sf::Transform& transform)
+{
+    float matrix[16];
+    transform.getMatrix(matrix);
+
+    return {matrix[0], matrix[4], matrix[12], matrix[1], matrix[5], matrix[13]};
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline void copyAttributes(const sf::Vertex& input, sf::Vertex& output)
+{
+    output.color     = input.color;
+    output.texCoords = input.texCoords;
+}
+
+
+////////////////////////////////////////////////////////////
+void transformVerticesScalar(const AffineMatrix& m, const sf::Vertex* input, sf::Vertex* output, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const sf::Vector2f position = input[i].position;
+
+        copyAttributes(input[i], output[i]);
+        output[i].position = {m.a00 * position.x + m.a01 * position.y + m.a02,
+                              m.a10 * position.x + m.a11 * position.y + m.a12};
+    }
+}
+
+
+#ifdef SFML_PRIV_VERTEX_UTILS_SSE2
+////////////////////////////////////////////////////////////
+void transformVerticesSSE2(const AffineMatrix& m, const sf::Vertex* input, sf::Vertex* output, std::size_t count)
+{
+    const __m128 column0     = _mm_setr_ps(m.a00, m.a10, m.a00, m.a10);
+    const __m128 column1     = _mm_setr_ps(m.a01, m.a11, m.a01, m.a11);
+    const __m128 translation = _mm_setr_ps(m.a02, m.a12, m.a02, m.a12);
+
+    std::size_t i = 0;
+
+    // Two vertices per iteration: (x0, y0, x1, y1)
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 positions = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&input[i].position));
+        positions        = _mm_loadh_pi(positions, reinterpret_cast<const __m64*>(&input[i + 1].position));
+
+        const __m128 xs = _mm_shuffle_ps(positions, positions, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ys = _mm_shuffle_ps(positions, positions, _MM_SHUFFLE(3, 3, 1, 1));
+
+        const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, column0), _mm_mul_ps(ys, column1)), translation);
+
+        copyAttributes(input[i], output[i]);
+        copyAttributes(input[i + 1], output[i + 1]);
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[i].position), result);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 1].position), result);
+    }
+
+    transformVerticesScalar(m, input + i, output + i, count - i);
+}
+#endif
+
+
+#ifdef SFML_PRIV_VERTEX_UTILS_AVX2
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void transformVerticesAVX2(const AffineMatrix& m,
+                                                   const sf::Vertex*   input,
+                                                   sf::Vertex*         output,
+                                                   std::size_t         count)
+{
+    const __m256 column0 = _mm256_setr_ps(m.a00, m.a10, m.a00, m.a10, m.a00, m.a10, m.a00, m.a10);
+    const __m256 column1 = _mm256_setr_ps(m.a01, m.a11, m.a01, m.a11, m.a01, m.a11, m.a01, m.a11);
+    const __m256 translation = _mm256_setr_ps(m.a02, m.a12, m.a02, m.a12, m.a02, m.a12, m.a02, m.a12);
+
+    std::size_t i = 0;
+
+    // Four vertices per iteration: (x0, y0, x1, y1, x2, y2, x3, y3)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 low  = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&input[i].position));
+        low         = _mm_loadh_pi(low, reinterpret_cast<const __m64*>(&input[i + 1].position));
+        __m128 high = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&input[i + 2].position));
+        high        = _mm_loadh_pi(high, reinterpret_cast<const __m64*>(&input[i + 3].position));
+
+        const __m256 positions = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+
+        const __m256 xs = _mm256_moveldup_ps(positions);
+        const __m256 ys = _mm256_movehdup_ps(positions);
+
+        const __m256 result = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xs, column0), _mm256_mul_ps(ys, column1)),
+                                            translation);
+
+        copyAttributes(input[i], output[i]);
+        copyAttributes(input[i + 1], output[i + 1]);
+        copyAttributes(input[i + 2], output[i + 2]);
+        copyAttributes(input[i + 3], output[i + 3]);
+
+        low  = _mm256_castps256_ps128(result);
+        high = _mm256_extractf128_ps(result, 1);
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[i].position), low);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 1].position), low);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[i + 2].position), high);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 3].position), high);
+    }
+
+    transformVerticesScalar(m, input + i, output + i, count - i);
+}
+#endif
+
+
+#ifdef SFML_PRIV_VERTEX_UTILS_NEON
+////////////////////////////////////////////////////////////
+void transformVerticesNEON(const AffineMatrix& m, const sf::Vertex* input, sf::Vertex* output, std::size_t count)
+{
+    const float column0Data[]{m.a00, m.a10};
+    const float column1Data[]{m.a01, m.a11};
+    const float translationData[]{m.a02, m.a12};
+
+    const float32x2_t column0     = vld1_f32(column0Data);
+    const float32x2_t column1     = vld1_f32(column1Data);
+    const float32x2_t translation = vld1_f32(translationData);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float32x2_t position = vld1_f32(&input[i].position.x);
+
+        const float32x2_t result = vadd_f32(vadd_f32(vmul_lane_f32(column0, position, 0),
+                                                     vmul_lane_f32(column1, position, 1)),
+                                            translation);
+
+        copyAttributes(input[i], output[i]);
+        vst1_f32(&output[i].position.x, result);
+    }
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
+using TransformVerticesFn = void (*)(const AffineMatrix&, const sf::Vertex*, sf::Vertex*, std::size_t);
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] TransformVerticesFn selectTransformVerticesFn()
+{
+#if defined(SFML_PRIV_VERTEX_UTILS_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return &transformVerticesAVX2;
+#endif
+
+#if defined(SFML_PRIV_VERTEX_UTILS_SSE2)
+    return &transformVerticesSSE2;
+#elif defined(SFML_PRIV_VERTEX_UTILS_NEON)
+    return &transformVerticesNEON;
+#else
+    return &transformVerticesScalar;
+#endif
+}
+
+} // namespace VertexUtilsImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void transformVertices(const Transform& transform, const Vertex* input, Vertex* output, std::size_t count)
+{
+    static const VertexUtilsImpl::TransformVerticesFn transformVerticesFn = VertexUtilsImpl::selectTransformVerticesFn();
+
+    transformVerticesFn(VertexUtilsImpl::toAffineMatrix(transform), input, output, count);
+}
+
+} // namespace sf
+
+#undef SFML_PRIV_VERTEX_UTILS_NEON
+#undef SFML_PRIV_VERTEX_UTILS_AVX2
+#undef SFML_PRIV_VERTEX_UTILS_SSE2
@@ -0,0 +1,143 @@
+#include "SFML/Base/FlatHashMap.hpp"
+
+#include <Doctest.hpp>
+
+#include <string>
+#include <unordered_map>
+
+#include <cstdint>
+
+namespace
+{
+namespace FlatHashMapTest // to support unity builds
+{
+// Sends every key to the same slot, to exercise probing and backward-shift deletion
+struct CollidingHash
+{
+    [[nodiscard]] std::uint64_t operator()(std::uint64_t) const
+    {
+        return 0u;
+    }
+};
+
+} // namespace FlatHashMapTest
+} // namespace
+
+TEST_CASE("[Base] Base/FlatHashMap.hpp")
+{
+    SECTION("Empty")
+    {
+        const sf::base::FlatHashMap<std::uint64_t, int> map;
+
+        CHECK(map.empty());
+        CHECK(map.size() == 0u);
+        CHECK(map.find(0u) == nullptr);
+        CHECK(!map.contains(42u));
+        CHECK(map.begin() == map.end());
+    }
+
+    SECTION("Emplace and find")
+    {
+        sf::base::FlatHashMap<std::uint64_t, std::string> map;
+
+        std::string& value = map.emplace(1u, "one");
+        CHECK(value == "one");
+        CHECK(map.size() == 1u);
+
+        // Existing keys are not overwritten
+        CHECK(&map.emplace(1u, "uno") == &value);
+        CHECK(value == "one");
+
+        map[2u] = "two";
+        CHECK(map.size() == 2u);
+        CHECK(*map.find(2u) == "two");
+        CHECK(map.contains(1u));
+        CHECK(!map.contains(3u));
+    }
+
+    SECTION("Growth")
+    {
+        sf::base::FlatHashMap<std::uint64_t, int> map;
+
+        for (int i = 0; i < 1000; ++i)
+            map.emplace(static_cast<std::uint64_t>(i) << 32, i);
+
+        CHECK(map.size() == 1000u);
+
+        for (int i = 0; i < 1000; ++i)
+            CHECK(*map.find(static_cast<std::uint64_t>(i) << 32) == i);
+    }
+
+    SECTION("Erase")
+    {
+        sf::base::FlatHashMap<std::uint64_t, int, FlatHashMapTest::CollidingHash> map;
+
+        for (int i = 0; i < 8; ++i)
+            map.emplace(static_cast<std::uint64_t>(i), i);
+
+        CHECK(!map.erase(100u));
+        CHECK(map.erase(3u));
+        CHECK(!map.erase(3u));
+        CHECK(map.erase(0u));
+        CHECK(map.erase(7u));
+
+        CHECK(map.size() == 5u);
+        CHECK(!map.contains(0u));
+        CHECK(!map.contains(3u));
+        CHECK(!map.contains(7u));
+
+        for (const int i : {1, 2, 4, 5, 6})
+            CHECK(*map.find(static_cast<std::uint64_t>(i)) == i);
+
+        map.emplace(3u, 30);
+        CHECK(*map.find(3u) == 30);
+        CHECK(map.size() == 6u);
+    }
+
+    SECTION("Matches std::unordered_map")
+    {
+        sf::base::FlatHashMap<std::uint64_t, std::uint64_t> map;
+        std::unordered_map<std::uint64_t, std::uint64_t>   reference;
+
+        std::uint64_t state = 12345u;
+        for (int i = 0; i < 5000; ++i)
+        {
+            state                   = state * 6364136223846793005ull + 1442695040888963407ull;
+            const std::uint64_t key = (state >> 33u) % 512u;
+
+            if ((state & 3u) == 0u)
+            {
+                CHECK(map.erase(key) == (reference.erase(key) == 1u));
+            }
+            else
+            {
+                map.emplace(key, state);
+                reference.emplace(key, state);
+            }
+        }
+
+        CHECK(map.size() == reference.size());
+
+        for (const auto& [key, value] : reference)
+            CHECK(*map.find(key) == value);
+
+        for (const auto& [key, value] : map)
+            CHECK(reference.at(key) == value);
+    }
+
+    SECTION("Clear and reserve")
+    {
+        sf::base::FlatHashMap<std::uint64_t, int> map;
+        map.reserve(100u);
+
+        for (int i = 0; i < 100; ++i)
+            map.emplace(static_cast<std::uint64_t>(i), i);
+
+        map.clear();
+        CHECK(map.empty());
+        CHECK(!map.contains(50u));
+
+        map.emplace(50u, 5);
+        CHECK(*map.find(50u) == 5);
+    }
+}
@@ -8,6 +8,8 @@
 // Other 1st party headers
 #include "SFML/System/FileInputStream.hpp"
 #include "SFML/System/Path.hpp"
+#include "SFML/System/Sleep.hpp"
+#include "SFML/System/Time.hpp"
 
 #include <Doctest.hpp>
 
@@ -57,6 +59,7 @@ TEST_CASE("[Graphics] sf::Font" * doctest::skip(skipDisplayTests))
             CHECK(texture.getSize() == sf::Vector2u{128, 128});
             CHECK(texture.isSmooth());
             CHECK(!texture.isSrgb());
+            CHECK(texture.isSingleChannel());
             CHECK(!texture.isRepeated());
             CHECK(texture.getNativeHandle() != 0);
             CHECK(font.isSmooth());
@@ -133,4 +136,220 @@ TEST_CASE("[Graphics] sf::Font" * doctest::skip(skipDisplayTests))
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Deferred glyph uploads")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 0);
+
+        const sf::Texture& texture = font.getTexture(16);
+        (void)font.getGlyph(0x45, 16, false);
+        (void)font.getGlyph(0x46, 16, false);
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 2);
+        CHECK(font.getGlyphStatistics().uploadedBytes == 0);
+        CHECK(font.getGlyphStatistics().textureUploads == 0);
+
+        CHECK(&font.getTexture(16) == &texture);
+        CHECK(font.getGlyphStatistics().uploadedBytes > 0);
+        CHECK(font.getGlyphStatistics().textureUploads == 1);
+
+        (void)font.getGlyph(0x45, 16, false);
+        (void)font.getTexture(16);
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 2);
+        CHECK(font.getGlyphStatistics().textureUploads == 1);
+
+        font.resetGlyphStatistics();
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 0);
+        CHECK(font.getGlyphStatistics().uploadedBytes == 0);
+        CHECK(font.getGlyphStatistics().textureUploads == 0);
+    }
+
+    SECTION("Prewarming")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+
+        SECTION("prewarm()")
+        {
+            font.prewarm(U"ABCA", 16);
+            CHECK(font.getGlyphStatistics().rasterizedGlyphs == 3);
+            CHECK(!font.isPrewarming());
+
+            (void)font.getGlyph(U'B', 16, false);
+            CHECK(font.getGlyphStatistics().rasterizedGlyphs == 3);
+        }
+
+        SECTION("prewarmInBackground()")
+        {
+            CHECK(font.prewarmInBackground(U"ABC", 24));
+
+            while (font.isPrewarming())
+                sf::sleep(sf::milliseconds(1));
+
+            CHECK(font.getGlyphStatistics().rasterizedGlyphs == 3);
+            CHECK(font.getGlyph(U'A', 24, false).advance > 0.f);
+            CHECK(font.getGlyphStatistics().rasterizedGlyphs == 3);
+            CHECK(font.getTexture(24).getSize().x > 0u);
+        }
+    }
+
+    SECTION("Distance field glyphs")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        CHECK(!font.isDistanceFieldEnabled());
+
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+        CHECK(font.getDistanceFieldSpread(32) == 2.f * font.getDistanceFieldSpread(16));
+
+        const sf::Glyph& smallGlyph = font.getGlyph(U'A', 16, false);
+        const sf::Glyph& largeGlyph = font.getGlyph(U'A', 32, false);
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 1);
+        CHECK(largeGlyph.advance == Approx(2.f * smallGlyph.advance));
+        CHECK(largeGlyph.bounds.size.x == Approx(2.f * smallGlyph.bounds.size.x));
+        CHECK(largeGlyph.textureRect == smallGlyph.textureRect);
+
+        CHECK(&font.getGlyph(U'A', 32, false, 2.f) == &largeGlyph);
+        CHECK(&font.getTexture(16) == &font.getTexture(32));
+        CHECK(font.getTexture(16).isSmooth());
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 1);
+    }
+
+    SECTION("Shared atlas")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        CHECK(!font.isSharedAtlasEnabled());
+        CHECK(&font.getTexture(16) != &font.getTexture(32));
+
+        font.setSharedAtlasEnabled(true);
+        CHECK(font.isSharedAtlasEnabled());
+
+        const sf::Glyph& smallGlyph = font.getGlyph(U'A', 16, false);
+        const sf::Glyph& largeGlyph = font.getGlyph(U'A', 32, true);
+        CHECK(&font.getTexture(16) == &font.getTexture(32));
+        CHECK(font.getTexture(16).getSize() == sf::Vector2u{128u, 128u});
+        CHECK(smallGlyph.textureRect.position != largeGlyph.textureRect.position);
+
+        auto otherFont = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        otherFont.shareAtlasWith(font);
+        CHECK(otherFont.isSharedAtlasEnabled());
+        CHECK(&otherFont.getTexture(24) == &font.getTexture(16));
+
+        const sf::Glyph& otherGlyph = otherFont.getGlyph(U'A', 16, false);
+        CHECK(otherGlyph.textureRect.position != smallGlyph.textureRect.position);
+
+        font.setSharedAtlasEnabled(false);
+        CHECK(!font.isSharedAtlasEnabled());
+        CHECK(&font.getTexture(16) != &otherFont.getTexture(16));
+        CHECK(&font.getTexture(16) != &font.getTexture(32));
+    }
+
+    SECTION("Kerning cache")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+
+        CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 2);
+
+        CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+        CHECK(font.getKerning(0x41, 0x42, 12, true) == font.getKerning(0x41, 0x42, 12, true));
+        CHECK(font.getGlyphStatistics().rasterizedGlyphs == 4);
+
+        CHECK(font.getKerning(0x1F600, 0x41, 12) == font.getKerning(0x1F600, 0x41, 12));
+        CHECK(font.hasGlyph(0x41));
+        CHECK(!font.hasGlyph(0x1F600));
+    }
+
+    SECTION("Glyph cache")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+
+        const sf::Glyph& regular = font.getGlyph(0x41, 16, false);
+        const sf::Glyph& bold    = font.getGlyph(0x41, 16, true);
+        CHECK(&font.getGlyph(0x41, 16, false) == &regular);
+        CHECK(&font.getGlyph(0x41, 16, true) == &bold);
+        CHECK(&regular != &bold);
+
+        // References stay valid while other glyphs are loaded
+        const sf::Glyph copy = regular;
+        for (char32_t codePoint = 0x20; codePoint < 0x250; ++codePoint)
+            (void)font.getGlyph(codePoint, 16, false);
+
+        CHECK(&font.getGlyph(0x41, 16, false) == &regular);
+        CHECK(regular.advance == copy.advance);
+        CHECK(regular.textureRect == copy.textureRect);
+        CHECK(&font.getGlyph(0x41, 16, false, 1.f) != &regular);
+    }
+
+    SECTION("Copy")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf");
+        REQUIRE(font.hasValue());
+
+        // Fill the direct lookup table of ASCII glyphs, then outlive the original font
+        const sf::Glyph original = font->getGlyph(U'A', 16, false);
+        (void)font->getGlyph(U'A', 16, false, 1.f);
+
+        sf::Font copy = *font;
+        font.reset();
+
+        const sf::Glyph& glyph = copy.getGlyph(U'A', 16, false);
+        CHECK(glyph.advance == original.advance);
+        CHECK(glyph.textureRect == original.textureRect);
+        CHECK(&copy.getGlyph(U'A', 16, false) == &glyph);
+        CHECK(copy.getGlyph(U'A', 16, false, 1.f).advance > 0.f);
+        CHECK(copy.getGlyphStatistics().cachedGlyphs == 2);
+
+        auto other = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        (void)other.getGlyph(U'B', 16, false);
+        other = copy;
+        CHECK(&other.getGlyph(U'A', 16, false) != &glyph);
+        CHECK(other.getGlyph(U'A', 16, false).textureRect == original.textureRect);
+    }
+
+    SECTION("Glyph cache budget")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        CHECK(font.getGlyphCacheBudget() == 0);
+
+        (void)font.getGlyph(0x41, 16, false);
+        (void)font.getGlyph(0x41, 16, false);
+        CHECK(font.getGlyphStatistics().cacheMisses == 1);
+        CHECK(font.getGlyphStatistics().cacheHits == 1);
+        CHECK(font.getGlyphStatistics().pageCount == 1);
+        CHECK(font.getGlyphStatistics().cachedGlyphs == 1);
+        CHECK(font.getGlyphStatistics().textureBytes == 128u * 128u);
+
+        // Loading glyphs only grows the atlas past the budget, glyphs are evicted by compactGlyphCache
+        font.setGlyphCacheBudget(128u * 128u);
+        CHECK(font.getGlyphCacheBudget() == 128u * 128u);
+
+        for (char32_t codePoint = 0x41; codePoint <= 0x5A; ++codePoint)
+        {
+            (void)font.getGlyph(codePoint, 48, false);
+            (void)font.getTexture(48);
+        }
+
+        CHECK(font.getGlyphStatistics().evictedGlyphs == 0);
+        CHECK(font.getGlyphStatistics().compactions == 0);
+        CHECK(font.getTexture(48).getSize() != sf::Vector2u{128u, 128u});
+
+        font.compactGlyphCache();
+        CHECK(font.getGlyphStatistics().evictedGlyphs > 0);
+        CHECK(font.getGlyphStatistics().compactions > 0);
+        CHECK(font.getGlyphStatistics().pageCount == 2);
+        CHECK(font.getGlyphStatistics().textureBytes <= 128u * 128u + 128u * 128u);
+        CHECK(font.getTexture(48).getSize() == sf::Vector2u{128u, 128u});
+
+        // The most recently used glyphs are kept
+        const std::size_t misses = font.getGlyphStatistics().cacheMisses;
+        const sf::Glyph&  glyph  = font.getGlyph(0x5A, 48, false);
+        CHECK(font.getGlyphStatistics().cacheMisses == misses);
+        CHECK(glyph.textureRect.position.x + glyph.textureRect.size.x <= 128);
+        CHECK(glyph.textureRect.position.y + glyph.textureRect.size.y <= 128);
+
+        font.resetGlyphStatistics();
+        CHECK(font.getGlyphStatistics().cacheHits == 0);
+        CHECK(font.getGlyphStatistics().evictedGlyphs == 0);
+        CHECK(font.getGlyphStatistics().pageCount == 2);
+    }
 }
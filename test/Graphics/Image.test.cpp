@@ -426,4 +426,43 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u{0, 9}) == sf::Color::Green);
     }
+
+    SECTION("createDownsampled()")
+    {
+        SECTION("Box filter")
+        {
+            auto image = sf::Image::create(sf::Vector2u{4, 2}, sf::Color::Black).value();
+            image.setPixel(sf::Vector2u{0, 0}, sf::Color::White);
+            image.setPixel(sf::Vector2u{1, 1}, sf::Color::White);
+            image.setPixel(sf::Vector2u{2, 0}, sf::Color::Red);
+            image.setPixel(sf::Vector2u{3, 0}, sf::Color::Red);
+            image.setPixel(sf::Vector2u{2, 1}, sf::Color::Red);
+            image.setPixel(sf::Vector2u{3, 1}, sf::Color::Red);
+
+            const auto downsampled = image.createDownsampled();
+            CHECK(downsampled.getSize() == sf::Vector2u{2, 1});
+            CHECK(downsampled.getPixel(sf::Vector2u{0, 0}) == sf::Color(128, 128, 128));
+            CHECK(downsampled.getPixel(sf::Vector2u{1, 0}) == sf::Color::Red);
+        }
+
+        SECTION("Alpha weighting")
+        {
+            auto image = sf::Image::create(sf::Vector2u{2, 2}, sf::Color::Transparent).value();
+            image.setPixel(sf::Vector2u{0, 0}, sf::Color::Green);
+
+            // Transparent black pixels don't darken the opaque one
+            CHECK(image.createDownsampled().getPixel(sf::Vector2u{0, 0}) == sf::Color(0, 255, 0, 64));
+        }
+
+        SECTION("Odd and unit sizes")
+        {
+            const auto image = sf::Image::create(sf::Vector2u{5, 1}, sf::Color::Blue).value();
+
+            const auto downsampled = image.createDownsampled();
+            CHECK(downsampled.getSize() == sf::Vector2u{2, 1});
+            CHECK(downsampled.getPixel(sf::Vector2u{1, 0}) == sf::Color::Blue);
+
+            CHECK(sf::Image::create(sf::Vector2u{1, 1}).value().createDownsampled().getSize() == sf::Vector2u{1, 1});
+        }
+    }
 }
@@ -0,0 +1,100 @@
+#include "SFML/Graphics/IndexBuffer.hpp"
+
+#include "SFML/Graphics/GraphicsContext.hpp"
+
+#include "SFML/Base/Traits/IsNothrowSwappable.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::IndexBuffer", "[.display]")
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::IndexBuffer));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::IndexBuffer));
+        STATIC_CHECK(SFML_BASE_IS_MOVE_CONSTRUCTIBLE(sf::IndexBuffer));
+        STATIC_CHECK(SFML_BASE_IS_MOVE_ASSIGNABLE(sf::IndexBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_SWAPPABLE(sf::IndexBuffer));
+    }
+
+    // Skip tests if vertex buffers aren't available
+    if (!sf::VertexBuffer::isAvailable(graphicsContext))
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::IndexBuffer indexBuffer(graphicsContext);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Stream);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(graphicsContext, sf::IndexBuffer::Usage::Static);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::IndexBuffer indexBuffer(graphicsContext);
+        CHECK(indexBuffer.create(96));
+        CHECK(indexBuffer.getIndexCount() == 96);
+        CHECK(indexBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        sf::IndexBuffer            indexBuffer(graphicsContext);
+        sf::IndexBuffer::IndexType indices[96]{};
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(!indexBuffer.update(indices));
+        }
+
+        CHECK(indexBuffer.create(96));
+
+        SECTION("Null indices")
+        {
+            CHECK(!indexBuffer.update(nullptr));
+        }
+
+        SECTION("Count + offset too large")
+        {
+            CHECK(!indexBuffer.update(indices, 90, 10));
+        }
+
+        CHECK(indexBuffer.update(indices));
+        CHECK(indexBuffer.update(indices, 48, 48));
+        CHECK(indexBuffer.getIndexCount() == 96);
+    }
+
+    SECTION("swap()")
+    {
+        sf::IndexBuffer indexBuffer1(graphicsContext, sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer1.create(50));
+
+        sf::IndexBuffer indexBuffer2(graphicsContext, sf::IndexBuffer::Usage::Stream);
+        CHECK(indexBuffer2.create(60));
+
+        sf::swap(indexBuffer1, indexBuffer2);
+
+        CHECK(indexBuffer1.getIndexCount() == 60);
+        CHECK(indexBuffer1.getUsage() == sf::IndexBuffer::Usage::Stream);
+
+        CHECK(indexBuffer2.getIndexCount() == 50);
+        CHECK(indexBuffer2.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+}
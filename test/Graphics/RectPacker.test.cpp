@@ -0,0 +1,129 @@
+#include "SFML/Graphics/RectPacker.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <SystemUtil.hpp>
+
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool overlaps(sf::Vector2u aPosition, sf::Vector2u aSize, sf::Vector2u bPosition, sf::Vector2u bSize)
+{
+    return aPosition.x < bPosition.x + bSize.x && bPosition.x < aPosition.x + aSize.x &&
+           aPosition.y < bPosition.y + bSize.y && bPosition.y < aPosition.y + aSize.y;
+}
+
+} // namespace
+
+TEST_CASE("[Graphics] sf::RectPacker")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::RectPacker));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::RectPacker));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::RectPacker));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::RectPacker));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::RectPacker));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::RectPacker packer({64u, 32u});
+        CHECK(packer.getSize() == sf::Vector2u{64u, 32u});
+    }
+
+    SECTION("pack()")
+    {
+        sf::RectPacker packer({64u, 64u});
+
+        SECTION("Invalid sizes")
+        {
+            CHECK(!packer.pack({0u, 16u}).hasValue());
+            CHECK(!packer.pack({16u, 0u}).hasValue());
+            CHECK(!packer.pack({65u, 16u}).hasValue());
+            CHECK(!packer.pack({16u, 65u}).hasValue());
+        }
+
+        SECTION("Whole area")
+        {
+            CHECK(packer.pack({64u, 64u}).value() == sf::Vector2u{0u, 0u});
+            CHECK(!packer.pack({1u, 1u}).hasValue());
+        }
+
+        SECTION("Bottom-left placement")
+        {
+            CHECK(packer.pack({32u, 16u}).value() == sf::Vector2u{0u, 0u});
+            CHECK(packer.pack({32u, 32u}).value() == sf::Vector2u{32u, 0u});
+            CHECK(packer.pack({32u, 16u}).value() == sf::Vector2u{0u, 16u});
+            CHECK(packer.pack({64u, 32u}).value() == sf::Vector2u{0u, 32u});
+            CHECK(!packer.pack({1u, 1u}).hasValue());
+        }
+
+        SECTION("No overlap")
+        {
+            std::vector<sf::Vector2u> positions;
+            std::vector<sf::Vector2u> sizes;
+
+            for (unsigned int i = 0u; i < 64u; ++i)
+            {
+                const sf::Vector2u size{1u + (i * 7u) % 13u, 1u + (i * 5u) % 11u};
+
+                const auto position = packer.pack(size);
+                if (!position.hasValue())
+                    continue;
+
+                CHECK(position->x + size.x <= 64u);
+                CHECK(position->y + size.y <= 64u);
+
+                for (std::size_t j = 0u; j < positions.size(); ++j)
+                    CHECK(!overlaps(*position, size, positions[j], sizes[j]));
+
+                positions.push_back(*position);
+                sizes.push_back(size);
+            }
+
+            CHECK(positions.size() > 32u);
+        }
+    }
+
+    SECTION("grow()")
+    {
+        sf::RectPacker packer({32u, 32u});
+        CHECK(packer.pack({32u, 32u}).value() == sf::Vector2u{0u, 0u});
+        CHECK(!packer.pack({32u, 32u}).hasValue());
+
+        SECTION("Wider")
+        {
+            packer.grow({64u, 32u});
+            CHECK(packer.getSize() == sf::Vector2u{64u, 32u});
+            CHECK(packer.pack({32u, 32u}).value() == sf::Vector2u{32u, 0u});
+        }
+
+        SECTION("Taller")
+        {
+            packer.grow({32u, 64u});
+            CHECK(packer.getSize() == sf::Vector2u{32u, 64u});
+            CHECK(packer.pack({32u, 32u}).value() == sf::Vector2u{0u, 32u});
+        }
+
+        SECTION("Never shrinks")
+        {
+            packer.grow({16u, 16u});
+            CHECK(packer.getSize() == sf::Vector2u{32u, 32u});
+            CHECK(!packer.pack({1u, 1u}).hasValue());
+        }
+    }
+
+    SECTION("clear()")
+    {
+        sf::RectPacker packer({32u, 32u});
+        CHECK(packer.pack({32u, 32u}).value() == sf::Vector2u{0u, 0u});
+
+        packer.clear();
+        CHECK(packer.getSize() == sf::Vector2u{32u, 32u});
+        CHECK(packer.pack({32u, 32u}).value() == sf::Vector2u{0u, 0u});
+    }
+}
@@ -1,10 +1,18 @@
+#include "SFML/Graphics/Font.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
 #include "SFML/Graphics/RectangleShape.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/SpriteInstance.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
+#include "SFML/Graphics/Text.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/System/Path.hpp"
 
 #include <Doctest.hpp>
 
@@ -332,4 +340,272 @@ TEST_CASE("[Graphics] Render Tests" * doctest::skip(skipDisplayTests))
             }
         }
     }
+
+    SECTION("Batching")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        sf::RectangleShape shape({50, 100});
+        shape.setFillColor(sf::Color::Green);
+
+        renderTexture.beginBatch();
+        CHECK(renderTexture.isBatching());
+
+        renderTexture.draw(shape, /* texture */ nullptr);
+
+        shape.setPosition({50, 0});
+        shape.setFillColor(sf::Color::Blue);
+        renderTexture.draw(shape, /* texture */ nullptr);
+
+        SECTION("Flushed on display")
+        {
+            renderTexture.display();
+            CHECK(renderTexture.isBatching());
+        }
+
+        SECTION("Flushed on end")
+        {
+            renderTexture.endBatch();
+            CHECK(!renderTexture.isBatching());
+            CHECK(renderTexture.getDrawStatistics().drawCalls == 1);
+            CHECK(renderTexture.getDrawStatistics().uploadedBytes > 0);
+            renderTexture.display();
+        }
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Batched distance field outlines")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        font.setDistanceFieldEnabled(true);
+
+        sf::Text text(font, "A", 32);
+
+        renderTexture.beginBatch();
+        renderTexture.draw(text);
+
+        // The outline is part of the render states, changing it must not affect the pending draw call
+        text.setOutlineThickness(2.f);
+        renderTexture.draw(text);
+        renderTexture.draw(text);
+
+        renderTexture.endBatch();
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 2);
+    }
+
+    SECTION("Redundant state changes")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 100});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape, /* texture */ nullptr);
+
+        // Same shader, buffers and transform: the second draw call does not need to rebind anything
+        renderTexture.resetDrawStatistics();
+        shape.setFillColor(sf::Color::Blue);
+        renderTexture.draw(shape, /* texture */ nullptr);
+
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 1);
+        CHECK(renderTexture.getDrawStatistics().redundantCallsAvoided > 0);
+
+        shape.setPosition({50, 0});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape, /* texture */ nullptr);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Blue);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Green);
+    }
+
+    SECTION("Deferred drawing")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        const auto greenTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                             sf::Image::create({1, 1}, sf::Color::Green).value())
+                                      .value();
+        const auto blueTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                            sf::Image::create({1, 1}, sf::Color::Blue).value())
+                                     .value();
+
+        sf::Sprite sprite({{0, 0}, {1, 1}});
+        sprite.setScale({25, 100});
+
+        renderTexture.beginDeferred();
+        CHECK(renderTexture.isDeferred());
+        CHECK(renderTexture.isBatching());
+
+        // Interleaved textures are sorted into one draw call per texture
+        for (int i = 0; i < 4; ++i)
+        {
+            sprite.setPosition({25.f * static_cast<float>(i), 0.f});
+            renderTexture.draw(sprite, i % 2 == 0 ? greenTexture : blueTexture);
+        }
+
+        renderTexture.endDeferred();
+        CHECK(!renderTexture.isDeferred());
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 2);
+
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({12, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({37, 50}) == sf::Color::Blue);
+        CHECK(image.getPixel({62, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({87, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Deferred drawing with stencil masks")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext,
+                                                       {100, 100},
+                                                       sf::ContextSettings{.depthBits = 0, .stencilBits = 8})
+                                 .value();
+
+        renderTexture.clear(sf::Color::Red, 0);
+
+        // Created first, so that the masks would be sorted before the contents by texture
+        const auto maskTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                            sf::Image::create({1, 1}, sf::Color::White).value())
+                                     .value();
+        const auto greenTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                             sf::Image::create({1, 1}, sf::Color::Green).value())
+                                      .value();
+        const auto blueTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                            sf::Image::create({1, 1}, sf::Color::Blue).value())
+                                     .value();
+
+        const auto writeMask = [](unsigned int value)
+        {
+            return sf::RenderStates{
+                sf::StencilMode{sf::StencilComparison::Always, sf::StencilUpdateOperation::Replace, value, 0xFF, true}};
+        };
+
+        const auto testMask = [](unsigned int value)
+        {
+            return sf::RenderStates{
+                sf::StencilMode{sf::StencilComparison::Equal, sf::StencilUpdateOperation::Keep, value, 0xFF, false}};
+        };
+
+        sf::Sprite sprite({{0, 0}, {1, 1}});
+        sprite.setScale({100, 100});
+
+        renderTexture.beginDeferred();
+
+        // First pair: the whole target is masked with 1, then filled with green
+        renderTexture.draw(sprite, maskTexture, writeMask(1));
+        renderTexture.draw(sprite, greenTexture, testMask(1));
+
+        // Second pair: the whole target is masked with 2, then its right half is filled with blue
+        renderTexture.draw(sprite, maskTexture, writeMask(2));
+        sprite.setScale({50, 100});
+        sprite.setPosition({50, 0});
+        renderTexture.draw(sprite, blueTexture, testMask(2));
+
+        renderTexture.endDeferred();
+        renderTexture.display();
+
+        // Submitting both masks first would leave the left half red
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Deferred queue submitted when full")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        const auto greenTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                             sf::Image::create({1, 1}, sf::Color::Green).value())
+                                      .value();
+
+        sf::Sprite sprite({{0, 0}, {1, 1}});
+        sprite.setScale({100, 100});
+
+        renderTexture.beginDeferred();
+
+        // More vertices than the streaming buffer holds, the queue cannot keep growing until the end
+        for (int i = 0; i < 20'000; ++i)
+            renderTexture.draw(sprite, greenTexture);
+
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 1);
+
+        renderTexture.endDeferred();
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 2);
+
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::Green);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        const sf::Vertex vertices[]{{{0.f, 0.f}, sf::Color::Green},
+                                    {{0.f, 100.f}, sf::Color::Green},
+                                    {{50.f, 0.f}, sf::Color::Green},
+                                    {{50.f, 100.f}, sf::Color::Green}};
+
+        SECTION("Indices")
+        {
+            const unsigned int indices[]{0u, 1u, 2u, 2u, 1u, 3u};
+            renderTexture.draw(vertices, 4, indices, 6, sf::PrimitiveType::Triangles);
+        }
+
+        SECTION("Quads")
+        {
+            renderTexture.drawQuads(vertices, 4);
+        }
+
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Red);
+    }
+
+    SECTION("Instanced drawing")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        sf::SpriteInstance instances[2]{};
+
+        for (sf::SpriteInstance& instance : instances)
+            instance.textureRect = {{0.f, 0.f}, {1.f, 1.f}};
+
+        instances[0].transform = sf::Transform().scale({50.f, 100.f});
+        instances[0].color     = sf::Color::Green;
+
+        instances[1].transform = sf::Transform().translate({50.f, 0.f}).scale({50.f, 100.f});
+        instances[1].color     = sf::Color::Blue;
+
+        renderTexture.drawInstanced(graphicsContext.getBuiltInWhiteDotTexture(), instances, 2);
+        CHECK(renderTexture.getDrawStatistics().drawCalls == 1);
+        CHECK(renderTexture.getDrawStatistics().uploadedBytes == sizeof(instances));
+
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+    }
 }
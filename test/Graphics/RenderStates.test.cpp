@@ -26,6 +26,8 @@ TEST_CASE("[Graphics] sf::RenderStates")
             CHECK(renderStates.coordinateType == sf::CoordinateType::Pixels);
             CHECK(renderStates.texture == nullptr);
             CHECK(renderStates.shader == nullptr);
+            CHECK(renderStates.distanceFieldOutlineThickness == 0.f);
+            CHECK(renderStates.distanceFieldOutlineColor == sf::Color::Transparent);
         }
 
         SECTION("BlendMode constructor")
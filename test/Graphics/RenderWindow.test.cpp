@@ -3,6 +3,7 @@
 // Other 1st party headers
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RectangleShape.hpp"
 #include "SFML/Graphics/Texture.hpp"
 #include "SFML/Graphics/View.hpp"
 
@@ -106,6 +107,44 @@ TEST_CASE("[Graphics] sf::RenderWindow" * doctest::skip(skipDisplayTests))
         CHECK(texture.copyToImage().getPixel(sf::Vector2u{196, 196}) == sf::Color::Blue);
     }
 
+    SECTION("Display flushes the batch")
+    {
+        sf::RenderWindow window(graphicsContext, {.size{256u, 256u}, .title = "RenderWindow Tests"});
+
+        window.clear(sf::Color::Red);
+        window.resetDrawStatistics();
+
+        sf::RectangleShape shape({256, 256});
+        shape.setFillColor(sf::Color::Green);
+
+        SECTION("Batch")
+        {
+            window.beginBatch();
+            window.draw(shape, /* texture */ nullptr);
+            CHECK(window.getDrawStatistics().drawCalls == 0);
+
+            window.display();
+            CHECK(window.isBatching());
+            CHECK(window.getDrawStatistics().drawCalls == 1);
+            window.endBatch();
+        }
+
+        SECTION("Deferred")
+        {
+            window.beginDeferred();
+            window.draw(shape, /* texture */ nullptr);
+            CHECK(window.getDrawStatistics().drawCalls == 0);
+
+            window.display();
+            CHECK(window.isDeferred());
+            CHECK(window.getDrawStatistics().drawCalls == 1);
+            window.endDeferred();
+        }
+
+        // Nothing is left to submit once the frame is presented
+        CHECK(window.getDrawStatistics().drawCalls == 1);
+    }
+
 // Creating multiple windows in Emscripten is not supported
 #ifndef SFML_SYSTEM_EMSCRIPTEN
     SECTION("Multiple windows 1")
@@ -118,6 +118,45 @@ void main()
 
 )glsl";
 
+constexpr auto uniformBlockVertexSource = R"glsl(#version 300 es
+
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+layout(std140) uniform Storm
+{
+    vec2  storm_position;
+    float storm_total_radius;
+    float storm_inner_radius;
+};
+
+layout(std140) uniform sf_u_BuiltInMatrices
+{
+    mat4 sf_u_modelViewProjectionMatrix;
+    mat4 sf_u_textureMatrix;
+};
+
+in vec2 sf_a_position;
+in vec4 sf_a_color;
+in vec2 sf_a_texCoord;
+
+out vec4 sf_v_color;
+out vec2 sf_v_texCoord;
+
+void main()
+{
+    vec2 offset = sf_a_position - storm_position;
+    float push  = length(offset) < storm_total_radius ? storm_inner_radius : 0.0;
+
+    gl_Position   = sf_u_modelViewProjectionMatrix * vec4(sf_a_position + normalize(offset) * push, 0.0, 1.0);
+    sf_v_texCoord = (sf_u_textureMatrix * vec4(sf_a_texCoord, 0.0, 1.0)).xy;
+    sf_v_color    = sf_a_color;
+}
+
+)glsl";
+
+
 constexpr auto fragmentSource = R"glsl(#version 300 es
 
 #ifdef GL_ES
@@ -259,6 +298,14 @@ TEST_CASE("[Graphics] sf::Shader" * doctest::skip(skipShaderFullTest))
             CHECK(static_cast<bool>(shader->getNativeHandle()));
     }
 
+    SECTION("setUniformBlockBinding()")
+    {
+        const auto shader = sf::Shader::loadFromMemory(graphicsContext, uniformBlockVertexSource, fragmentSource).value();
+        CHECK(shader.setUniformBlockBinding("Storm", 1));
+        CHECK(!shader.setUniformBlockBinding("Lighting", 1));
+        CHECK(!shader.getUniformLocation("sf_u_modelViewProjectionMatrix").hasValue());
+    }
+
     SECTION("loadFromStream()")
     {
         auto vertexShaderStream   = sf::FileInputStream::open("Graphics/shader.vert").value();
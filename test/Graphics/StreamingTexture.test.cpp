@@ -0,0 +1,87 @@
+#include "SFML/Graphics/StreamingTexture.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::StreamingTexture" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::StreamingTexture));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::StreamingTexture));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::StreamingTexture));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::StreamingTexture));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::StreamingTexture));
+    }
+
+    const auto image = sf::Image::create({256, 128}, sf::Color::Red).value();
+
+    SECTION("create()")
+    {
+        const auto streamingTexture = sf::StreamingTexture::create(graphicsContext, image).value();
+        CHECK(streamingTexture.getTexture().getSize() == sf::Vector2u{256, 128});
+        CHECK(streamingTexture.getLevelCount() == 9);
+        CHECK(streamingTexture.getTargetLevel() == 0);
+
+        // Levels up to 64x64 are uploaded right away: 64x32 is level 2
+        CHECK(streamingTexture.getResidentLevel() == 2);
+        CHECK(streamingTexture.getPendingBytes() == (256u * 128u + 128u * 64u) * 4u);
+    }
+
+    SECTION("Smallest level is always resident")
+    {
+        const auto streamingTexture = sf::StreamingTexture::create(graphicsContext, image, false, 0u).value();
+        CHECK(streamingTexture.getResidentLevel() == 8);
+    }
+
+    SECTION("stream()")
+    {
+        auto streamingTexture = sf::StreamingTexture::create(graphicsContext, image).value();
+
+        // Level 1 is 128x64, half of it fits in the budget
+        CHECK(streamingTexture.stream(128u * 32u * 4u) == 128u * 32u * 4u);
+        CHECK(streamingTexture.getResidentLevel() == 2);
+        CHECK(streamingTexture.getPendingBytes() == (256u * 128u + 128u * 32u) * 4u);
+
+        // A tiny budget still uploads a row
+        CHECK(streamingTexture.stream(1u) == 128u * 4u);
+
+        CHECK(streamingTexture.stream(1024u * 1024u) == (256u * 128u + 128u * 31u) * 4u);
+        CHECK(streamingTexture.getResidentLevel() == 0);
+        CHECK(streamingTexture.getPendingBytes() == 0);
+        CHECK(streamingTexture.stream(1024u * 1024u) == 0);
+
+        CHECK(streamingTexture.getTexture().copyToImage().getPixel({200, 100}) == sf::Color::Red);
+    }
+
+    SECTION("Set/get target level")
+    {
+        auto streamingTexture = sf::StreamingTexture::create(graphicsContext, image).value();
+
+        streamingTexture.setTargetLevel(1);
+        CHECK(streamingTexture.getTargetLevel() == 1);
+        CHECK(streamingTexture.getPendingBytes() == 128u * 64u * 4u);
+
+        CHECK(streamingTexture.stream(1024u * 1024u) == 128u * 64u * 4u);
+        CHECK(streamingTexture.getResidentLevel() == 1);
+        CHECK(streamingTexture.stream(1024u * 1024u) == 0);
+
+        streamingTexture.setTargetLevel(100);
+        CHECK(streamingTexture.getTargetLevel() == 8);
+
+        streamingTexture.setTargetLevel(0);
+        CHECK(streamingTexture.getPendingBytes() == 256u * 128u * 4u);
+    }
+}
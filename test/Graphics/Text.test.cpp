@@ -5,12 +5,15 @@
 // Other 1st party headers
 #include "SFML/Graphics/Color.hpp"
 #include "SFML/Graphics/Font.hpp"
+#include "SFML/Graphics/Glyph.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
 
 #include "SFML/System/LifetimeDependee.hpp"
 #include "SFML/System/Path.hpp"
 #include "SFML/System/String.hpp"
 
 #include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Math/Floor.hpp"
 #include "SFML/Base/Optional.hpp"
 
 #include <Doctest.hpp>
@@ -49,6 +52,9 @@ TEST_CASE("[Graphics] sf::Text" * doctest::skip(skipDisplayTests))
             CHECK(text.getFillColor() == sf::Color::White);
             CHECK(text.getOutlineColor() == sf::Color::Black);
             CHECK(text.getOutlineThickness() == 0);
+            CHECK(text.getAlignment() == sf::Text::Alignment::Left);
+            CHECK(text.getMaxWidth() == 0.f);
+            CHECK(text.getLineCount() == 1);
             CHECK(text.findCharacterPos(0) == sf::Vector2f());
             CHECK(text.getLocalBounds() == sf::FloatRect());
             CHECK(text.getGlobalBounds() == sf::FloatRect());
@@ -153,6 +159,20 @@ TEST_CASE("[Graphics] sf::Text" * doctest::skip(skipDisplayTests))
         CHECK(text.getOutlineThickness() == 3.14f);
     }
 
+    SECTION("Set/get alignment")
+    {
+        sf::Text text(font);
+        text.setAlignment(sf::Text::Alignment::Center);
+        CHECK(text.getAlignment() == sf::Text::Alignment::Center);
+    }
+
+    SECTION("Set/get max width")
+    {
+        sf::Text text(font);
+        text.setMaxWidth(200.f);
+        CHECK(text.getMaxWidth() == 200.f);
+    }
+
     SECTION("findCharacterPos()")
     {
         sf::Text text(font, "\tabcdefghijklmnopqrstuvwxyz \n");
@@ -196,6 +216,203 @@ TEST_CASE("[Graphics] sf::Text" * doctest::skip(skipDisplayTests))
         }
     }
 
+    SECTION("Line layout")
+    {
+        sf::Text text(font, "first line\nthe second line is longer");
+
+        const float lineSpacing = font.getLineSpacing(text.getCharacterSize());
+
+        SECTION("Line breaks")
+        {
+            REQUIRE(text.getLineCount() == 2);
+
+            const sf::Text::LineMetrics& first  = text.getLineMetrics(0);
+            const sf::Text::LineMetrics& second = text.getLineMetrics(1);
+
+            CHECK(first.firstCharacter == 0);
+            CHECK(first.characterCount == 11);
+            CHECK(first.position == sf::Vector2f{});
+            CHECK(first.height == lineSpacing);
+            CHECK(second.firstCharacter == 11);
+            CHECK(second.characterCount == 25);
+            CHECK(second.position == sf::Vector2f{0.f, lineSpacing});
+            CHECK(second.width > first.width);
+            CHECK(second.width == text.findCharacterPos(36).x);
+        }
+
+        SECTION("Wrapping")
+        {
+            const float maxWidth = text.getLineMetrics(1).width / 2.f;
+            text.setMaxWidth(maxWidth);
+
+            REQUIRE(text.getLineCount() >= 3);
+
+            for (std::size_t i = 0; i < text.getLineCount(); ++i)
+            {
+                const sf::Text::LineMetrics& line = text.getLineMetrics(i);
+
+                CHECK(line.width <= maxWidth);
+                CHECK(line.position.y == static_cast<float>(i) * lineSpacing);
+
+                // Lines are wrapped between words
+                if (i > 0)
+                    CHECK((text.getString()[line.firstCharacter - 1] == U' ' ||
+                           text.getString()[line.firstCharacter - 1] == U'\n'));
+            }
+
+            // Wrapped lines cover all the characters
+            const sf::Text::LineMetrics& lastLine = text.getLineMetrics(text.getLineCount() - 1);
+            CHECK(lastLine.firstCharacter + lastLine.characterCount == text.getString().getSize());
+        }
+
+        SECTION("Wrapping a long word")
+        {
+            text.setString("abcdefghijklmnopqrstuvwxyz");
+            text.setMaxWidth(100.f);
+
+            CHECK(text.getLineCount() > 1);
+
+            for (std::size_t i = 0; i < text.getLineCount(); ++i)
+                CHECK(text.getLineMetrics(i).width <= 100.f);
+        }
+
+        SECTION("Alignment")
+        {
+            const float firstWidth  = text.getLineMetrics(0).width;
+            const float secondWidth = text.getLineMetrics(1).width;
+
+            text.setAlignment(sf::Text::Alignment::Right);
+            CHECK(text.getLineMetrics(0).position.x == sf::base::floor(secondWidth - firstWidth));
+            CHECK(text.getLineMetrics(1).position.x == 0.f);
+            CHECK(text.findCharacterPos(0).x == text.getLineMetrics(0).position.x);
+
+            text.setAlignment(sf::Text::Alignment::Center);
+            CHECK(text.getLineMetrics(0).position.x == sf::base::floor((secondWidth - firstWidth) / 2.f));
+
+            text.setMaxWidth(1000.f);
+            CHECK(text.getLineMetrics(1).position.x == sf::base::floor((1000.f - secondWidth) / 2.f));
+        }
+
+        SECTION("findCharacterIndex()")
+        {
+            text.setPosition({120, 240});
+
+            for (std::size_t i = 0; i <= text.getString().getSize(); ++i)
+                CHECK(text.findCharacterIndex(text.findCharacterPos(i) + sf::Vector2f{0.5f, 1.f}) == i);
+
+            // Points outside of the text hit the closest line and character
+            CHECK(text.findCharacterIndex({0, 0}) == 0);
+            CHECK(text.findCharacterIndex({10'000, 10'000}) == text.getString().getSize());
+            CHECK(text.findCharacterIndex({10'000, 241}) == 10);
+        }
+    }
+
+    SECTION("Incremental updates")
+    {
+        const auto checkSameGeometry = [](const sf::Text& text, const sf::Text& reference)
+        {
+            const sf::Text::VertexSpan vertices          = text.getVertices();
+            const sf::Text::VertexSpan referenceVertices = reference.getVertices();
+
+            REQUIRE(vertices.size == referenceVertices.size);
+            for (std::size_t i = 0; i < vertices.size; ++i)
+            {
+                CHECK(vertices.data[i].position == referenceVertices.data[i].position);
+                CHECK(vertices.data[i].color == referenceVertices.data[i].color);
+                CHECK(vertices.data[i].texCoords == referenceVertices.data[i].texCoords);
+            }
+
+            CHECK(text.getLocalBounds() == reference.getLocalBounds());
+
+            for (std::size_t i = 0; i <= text.getString().getSize(); ++i)
+                CHECK(text.findCharacterPos(i) == reference.findCharacterPos(i));
+        };
+
+        sf::Text text(font, "Hello");
+
+        SECTION("Append")
+        {
+            (void)text.getVertices();
+            text.setString("Hello, world\nand more");
+            checkSameGeometry(text, sf::Text(font, "Hello, world\nand more"));
+        }
+
+        SECTION("Append with outline")
+        {
+            text.setOutlineThickness(2.f);
+            (void)text.getVertices();
+            text.setString("Hello AV");
+            text.setString("Hello AVA");
+
+            sf::Text reference(font, "Hello AVA");
+            reference.setOutlineThickness(2.f);
+            checkSameGeometry(text, reference);
+        }
+
+        SECTION("Append, then change colors")
+        {
+            (void)text.getVertices();
+            text.setString("Hello!");
+            text.setFillColor(sf::Color::Red);
+
+            sf::Text reference(font, "Hello!");
+            reference.setFillColor(sf::Color::Red);
+            checkSameGeometry(text, reference);
+        }
+
+        SECTION("Append, then change style")
+        {
+            (void)text.getVertices();
+            text.setString("Hello!");
+            text.setStyle(sf::Text::Style::Underlined);
+
+            sf::Text reference(font, "Hello!");
+            reference.setStyle(sf::Text::Style::Underlined);
+            checkSameGeometry(text, reference);
+        }
+    }
+
+    SECTION("Glyph cache compacted between batches")
+    {
+        auto smallFont = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        smallFont.setGlyphCacheBudget(128u * 128u);
+
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {256, 256}).value();
+
+        const sf::Text first(smallFont, "abcdefghij", 48);
+        const sf::Text second(smallFont, "ABCDEFGHIJ", 48);
+
+        // The glyphs of the second text don't fit in the budget, but the quads of the first one are still pending
+        renderTexture.beginBatch();
+        renderTexture.draw(first);
+
+        const sf::Glyph&  glyph = smallFont.getGlyph(U'a', 48, false);
+        const sf::IntRect rect  = glyph.textureRect;
+        renderTexture.draw(second);
+
+        CHECK(smallFont.getGlyphStatistics().compactions == 0);
+        CHECK(smallFont.getGlyphStatistics().textureBytes > 128u * 128u);
+        CHECK(glyph.textureRect == rect);
+        renderTexture.endBatch();
+
+        // Nothing is pending anymore: the cache can be brought back within the budget
+        smallFont.compactGlyphCache();
+        CHECK(smallFont.getGlyphStatistics().compactions == 1);
+        CHECK(smallFont.getGlyphStatistics().evictedGlyphs > 0);
+        CHECK(smallFont.getGlyphStatistics().textureBytes <= 128u * 128u);
+
+        // The texts are laid out again with the new texture
+        const sf::Text::VertexSpan vertices = second.getVertices();
+
+        REQUIRE(vertices.size == 40);
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            const sf::Glyph&   secondGlyph = smallFont.getGlyph(U'A' + static_cast<char32_t>(i), 48, false);
+            const sf::Vector2f topLeft = secondGlyph.textureRect.position.to<sf::Vector2f>() - sf::Vector2f{1.f, 1.f};
+            CHECK(vertices.data[i * 4].texCoords == topLeft);
+        }
+    }
+
 #ifdef SFML_ENABLE_LIFETIME_TRACKING
     SECTION("Lifetime tracking")
     {
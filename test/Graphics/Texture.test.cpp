@@ -3,8 +3,11 @@
 // Other 1st party headers
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Sprite.hpp"
 
 #include "SFML/System/FileInputStream.hpp"
+#include "SFML/System/MemoryInputStream.hpp"
 #include "SFML/System/Path.hpp"
 
 #include "SFML/Base/Macros.hpp"
@@ -17,6 +20,10 @@
 #include <LoadIntoMemoryUtil.hpp>
 #include <WindowUtil.hpp>
 
+#include <vector>
+
+#include <cstring>
+
 TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
 {
     sf::GraphicsContext graphicsContext;
@@ -80,6 +87,42 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
         }
     }
 
+    SECTION("createSingleChannel()")
+    {
+        CHECK(!sf::Texture::createSingleChannel(graphicsContext, {0, 1}).hasValue());
+
+        auto texture = sf::Texture::createSingleChannel(graphicsContext, {3, 2}).value();
+        CHECK(texture.getSize() == sf::Vector2u{3, 2});
+        CHECK(texture.isSingleChannel());
+        CHECK(!texture.isSrgb());
+        CHECK(texture.getNativeHandle() != 0);
+
+        SECTION("update() from values")
+        {
+            constexpr std::uint8_t values[]{0, 64, 255, 128, 32, 16};
+            texture.update(values);
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+            CHECK(image.getPixel({2, 0}) == sf::Color::White);
+            CHECK(image.getPixel({0, 1}) == sf::Color(255, 255, 255, 128));
+            CHECK(image.getPixel({2, 1}) == sf::Color(255, 255, 255, 16));
+        }
+
+        SECTION("update() from image")
+        {
+            texture.update(sf::Image::create({3, 2}, sf::Color(10, 20, 30, 40)).value());
+            CHECK(texture.copyToImage().getPixel({1, 1}) == sf::Color(255, 255, 255, 40));
+        }
+
+        SECTION("Copy semantics")
+        {
+            const sf::Texture textureCopy(texture); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(textureCopy.isSingleChannel());
+            CHECK(textureCopy.getSize() == sf::Vector2u{3, 2});
+        }
+    }
+
     SECTION("loadFromFile()")
     {
         const auto texture = sf::Texture::loadFromFile(graphicsContext, "Graphics/sfml-logo-big.png").value();
@@ -112,6 +155,146 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
         CHECK(texture.getNativeHandle() != 0);
     }
 
+    SECTION("Compressed containers")
+    {
+        const auto writeU32 = [](std::vector<std::uint8_t>& data, std::size_t offset, std::uint32_t value)
+        {
+            for (std::size_t i = 0; i < 4; ++i)
+                data[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+        };
+
+        // Textures holding compressed pixels cannot be read back, draw them to read their pixels
+        const auto drawToImage = [&](const sf::Texture& texture)
+        {
+            auto renderTexture = sf::RenderTexture::create(graphicsContext, texture.getSize()).value();
+            renderTexture.clear(sf::Color::Transparent);
+            renderTexture.draw(sf::Sprite(texture.getRect()), texture);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        // 4x4 BC1 block whose rows alternate between its red and blue endpoints
+        constexpr std::uint8_t bc1Block[] = {0x00, 0xF8, 0x1F, 0x00, 0x00, 0x55, 0x00, 0x55};
+
+        const auto makeDds = [&](const char* fourCC, unsigned int levelCount)
+        {
+            std::vector<std::uint8_t> dds(128 + 8 * levelCount);
+            std::memcpy(dds.data(), "DDS ", 4);
+            writeU32(dds, 4, 124);
+            writeU32(dds, 12, 4);          // Height
+            writeU32(dds, 16, 4);          // Width
+            writeU32(dds, 28, levelCount); // Mipmap count
+            writeU32(dds, 80, 0x4);        // Four CC flag
+            std::memcpy(dds.data() + 84, fourCC, 4);
+
+            for (unsigned int level = 0; level < levelCount; ++level)
+                std::memcpy(dds.data() + 128 + 8 * level, bc1Block, sizeof(bc1Block));
+
+            return dds;
+        };
+
+        SECTION("DDS")
+        {
+            const auto dds     = makeDds("DXT1", 1);
+            const auto texture = sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size()).value();
+            CHECK(texture.getSize() == sf::Vector2u{4, 4});
+            CHECK(!texture.isSrgb());
+
+            const auto image = drawToImage(texture);
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({3, 1}) == sf::Color::Blue);
+            CHECK(image.getPixel({2, 2}) == sf::Color::Red);
+            CHECK(image.getPixel({1, 3}) == sf::Color::Blue);
+        }
+
+        SECTION("DDS with mipmap")
+        {
+            const auto dds     = makeDds("DXT1", 3);
+            const auto texture = sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size()).value();
+            CHECK(texture.getSize() == sf::Vector2u{4, 4});
+            CHECK(drawToImage(texture).getPixel({0, 1}) == sf::Color::Blue);
+        }
+
+        SECTION("Sub-area")
+        {
+            const auto        dds = makeDds("DXT1", 1);
+            const sf::IntRect area{{0, 1}, {2, 2}};
+
+            const auto texture = sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size(), false, area);
+            REQUIRE(texture.hasValue());
+            CHECK(texture->getSize() == sf::Vector2u{2, 2});
+            CHECK(texture->copyToImage().getPixel({0, 0}) == sf::Color::Blue);
+            CHECK(texture->copyToImage().getPixel({1, 1}) == sf::Color::Red);
+        }
+
+        SECTION("KTX2")
+        {
+            std::vector<std::uint8_t> ktx2(80 + 24 + 8);
+            constexpr std::uint8_t identifier[]{0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+            std::memcpy(ktx2.data(), identifier, sizeof(identifier));
+            writeU32(ktx2, 12, 147); // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            writeU32(ktx2, 16, 1);   // Type size
+            writeU32(ktx2, 20, 4);   // Width
+            writeU32(ktx2, 24, 4);   // Height
+            writeU32(ktx2, 36, 1);   // Face count
+            writeU32(ktx2, 40, 1);   // Level count
+            writeU32(ktx2, 80, 104); // Offset of level 0
+            writeU32(ktx2, 88, 8);   // Size of level 0
+            writeU32(ktx2, 96, 8);   // Uncompressed size of level 0
+
+            // Individual mode, red left half and green right half, smallest modifier added to all pixels
+            constexpr std::uint8_t etc2Block[] = {0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+            std::memcpy(ktx2.data() + 104, etc2Block, sizeof(etc2Block));
+
+            sf::MemoryInputStream stream(ktx2.data(), ktx2.size());
+            const auto            texture = sf::Texture::loadFromStream(graphicsContext, stream).value();
+            CHECK(texture.getSize() == sf::Vector2u{4, 4});
+
+            const auto image = drawToImage(texture);
+            CHECK(image.getPixel({1, 3}) == sf::Color(255, 2, 2));
+            CHECK(image.getPixel({2, 0}) == sf::Color(2, 255, 2));
+        }
+
+        SECTION("sRGB flag of the container")
+        {
+            auto dds = makeDds("DX10", 1);
+            dds.insert(dds.begin() + 128, 20, 0);
+            writeU32(dds, 128, 72); // DXGI_FORMAT_BC1_UNORM_SRGB
+            writeU32(dds, 132, 3);  // 2D texture
+            writeU32(dds, 140, 1);  // Array size
+
+            const auto texture = sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size()).value();
+            CHECK(texture.isSrgb());
+        }
+
+        SECTION("Invalid containers")
+        {
+            auto dds = makeDds("DXT1", 1);
+            dds.resize(130);
+            CHECK(!sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size()).hasValue());
+
+            dds = makeDds("ATI2", 1);
+            CHECK(!sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size()).hasValue());
+
+            // Widths whose block count would wrap around in 32 bits
+            dds = makeDds("DXT1", 1);
+            writeU32(dds, 16, 0xFFFFFFFD);
+            CHECK(!sf::Texture::loadFromMemory(graphicsContext, dds.data(), dds.size()).hasValue());
+
+            std::vector<std::uint8_t> ktx2(80 + 24 + 8);
+            constexpr std::uint8_t identifier[]{0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+            std::memcpy(ktx2.data(), identifier, sizeof(identifier));
+            writeU32(ktx2, 12, 133);        // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            writeU32(ktx2, 20, 0xFFFFFFFF); // Width
+            writeU32(ktx2, 24, 4);          // Height
+            writeU32(ktx2, 36, 1);          // Face count
+            writeU32(ktx2, 40, 1);          // Level count
+            writeU32(ktx2, 80, 104);        // Offset of level 0
+            writeU32(ktx2, 88, 8);          // Size of level 0
+            CHECK(!sf::Texture::loadFromMemory(graphicsContext, ktx2.data(), ktx2.size()).hasValue());
+        }
+    }
+
     SECTION("loadFromImage()")
     {
         SECTION("Subarea of image")
@@ -228,6 +411,65 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
         }
     }
 
+    SECTION("updateAsync()")
+    {
+        constexpr std::uint8_t yellow[] = {0xFF, 0xFF, 0x00, 0xFF};
+        constexpr std::uint8_t cyan[]   = {0x00, 0xFF, 0xFF, 0xFF};
+
+        SECTION("Pixels")
+        {
+            auto       texture = sf::Texture::create(graphicsContext, sf::Vector2u{1, 1}).value();
+            const auto ticket  = texture.updateAsync(yellow);
+            CHECK(ticket.sequence != 0);
+            texture.waitForUpload(ticket);
+            CHECK(texture.isUploadComplete(ticket));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u{0, 0}) == sf::Color::Yellow);
+        }
+
+        SECTION("Pixels, size and destination")
+        {
+            auto texture = sf::Texture::create(graphicsContext, sf::Vector2u{2, 1}).value();
+            texture.updateAsync(yellow, sf::Vector2u{1, 1}, sf::Vector2u{0, 0});
+            texture.updateAsync(cyan, sf::Vector2u{1, 1}, sf::Vector2u{1, 0});
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u{0, 0}) == sf::Color::Yellow);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u{1, 0}) == sf::Color::Cyan);
+        }
+
+        SECTION("More uploads than buffers")
+        {
+            auto texture = sf::Texture::create(graphicsContext, sf::Vector2u{1, 1}).value();
+
+            sf::Texture::UploadTicket first;
+            sf::Texture::UploadTicket last;
+
+            for (int i = 0; i < 8; ++i)
+            {
+                last = texture.updateAsync((i % 2 == 0) ? cyan : yellow);
+                if (i == 0)
+                    first = last;
+            }
+
+            texture.flushUploads();
+            CHECK(last.sequence > first.sequence);
+            CHECK(texture.isUploadComplete(first));
+            texture.waitForUpload(last);
+            CHECK(texture.isUploadComplete(last));
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u{0, 0}) == sf::Color::Yellow);
+        }
+
+        SECTION("Single channel")
+        {
+            constexpr std::uint8_t values[] = {0x10, 0x20, 0x30};
+
+            auto texture = sf::Texture::createSingleChannel(graphicsContext, sf::Vector2u{3, 1}).value();
+            texture.waitForUpload(texture.updateAsync(values));
+
+            const auto image = texture.copyToImage();
+            CHECK(image.getPixel(sf::Vector2u{0, 0}) == sf::Color(0xFF, 0xFF, 0xFF, 0x10));
+            CHECK(image.getPixel(sf::Vector2u{2, 0}) == sf::Color(0xFF, 0xFF, 0xFF, 0x30));
+        }
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture = sf::Texture::create(graphicsContext, {64, 64}).value();
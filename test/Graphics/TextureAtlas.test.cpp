@@ -0,0 +1,134 @@
+#include "SFML/Graphics/TextureAtlas.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/System/RectUtils.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::TextureAtlas" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::TextureAtlas));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextureAtlas));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TextureAtlas));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TextureAtlas));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::TextureAtlas));
+    }
+
+    SECTION("create()")
+    {
+        SECTION("Invalid page size")
+        {
+            CHECK(!sf::TextureAtlas::create(graphicsContext, {0u, 64u}).hasValue());
+            CHECK(!sf::TextureAtlas::create(graphicsContext, {64u, 0u}).hasValue());
+
+            const unsigned int maxSize = sf::Texture::getMaximumSize(graphicsContext);
+            CHECK(!sf::TextureAtlas::create(graphicsContext, {maxSize + 1u, 64u}).hasValue());
+        }
+
+        SECTION("Valid page size")
+        {
+            const auto atlas = sf::TextureAtlas::create(graphicsContext, {64u, 64u}).value();
+            CHECK(atlas.getPageCount() == 0u);
+            CHECK(!atlas.isSmooth());
+        }
+    }
+
+    SECTION("add()")
+    {
+        auto atlas = sf::TextureAtlas::create(graphicsContext, {64u, 64u}, /* padding */ 1u, /* extrusion */ 1u).value();
+
+        SECTION("Empty image")
+        {
+            CHECK(!atlas.add(nullptr, {4u, 4u}).hasValue());
+            CHECK(atlas.getPageCount() == 0u);
+        }
+
+        SECTION("Image too large")
+        {
+            const unsigned int maxSize = sf::Texture::getMaximumSize(graphicsContext);
+            const std::uint8_t pixel[4]{};
+            CHECK(!atlas.add(pixel, {maxSize, 1u}).hasValue());
+        }
+
+        SECTION("Pixels and extrusion")
+        {
+            auto image = sf::Image::create({2u, 2u}, sf::Color::Red).value();
+            image.setPixel({1u, 1u}, sf::Color::Blue);
+
+            const auto entry = atlas.add(image).value();
+            CHECK(entry.pageIndex == 0u);
+            CHECK(entry.textureRect == sf::IntRect({1, 1}, {2, 2}));
+            CHECK(atlas.getPageCount() == 1u);
+            CHECK(atlas.getTexture().getSize() == sf::Vector2u{64u, 64u});
+
+            const sf::Image pageImage = atlas.getTexture().copyToImage();
+            CHECK(pageImage.getPixel({1u, 1u}) == sf::Color::Red);
+            CHECK(pageImage.getPixel({2u, 2u}) == sf::Color::Blue);
+            CHECK(pageImage.getPixel({0u, 0u}) == sf::Color::Red);
+            CHECK(pageImage.getPixel({3u, 3u}) == sf::Color::Blue);
+            CHECK(pageImage.getPixel({4u, 4u}) == sf::Color::Transparent);
+        }
+
+        SECTION("Separate entries")
+        {
+            const auto image  = sf::Image::create({8u, 8u}, sf::Color::Green).value();
+            const auto first  = atlas.add(image).value();
+            const auto second = atlas.add(image).value();
+
+            CHECK(first.pageIndex == second.pageIndex);
+            CHECK(!sf::findIntersection(first.textureRect, second.textureRect).hasValue());
+        }
+
+        SECTION("Page growth")
+        {
+            const auto image = sf::Image::create({30u, 30u}, sf::Color::White).value();
+
+            const sf::Texture& texture = atlas.getTexture(atlas.add(image).value().pageIndex);
+            for (int i = 0; i < 3; ++i)
+                CHECK(atlas.add(image).value().pageIndex == 0u);
+
+            CHECK(atlas.getPageCount() == 1u);
+            CHECK(&atlas.getTexture() == &texture);
+            CHECK(texture.getSize() == sf::Vector2u{128u, 128u});
+
+            // The area added by the growth is transparent, not uninitialized
+            CHECK(texture.copyToImage().getPixel({127u, 127u}) == sf::Color::Transparent);
+        }
+    }
+
+    SECTION("setSmooth()")
+    {
+        auto atlas = sf::TextureAtlas::create(graphicsContext, {16u, 16u}).value();
+        (void)atlas.add(sf::Image::create({4u, 4u}, sf::Color::White).value());
+
+        atlas.setSmooth(true);
+        CHECK(atlas.isSmooth());
+        CHECK(atlas.getTexture().isSmooth());
+
+        const auto entry = atlas.add(sf::Image::create({4u, 4u}, sf::Color::White).value()).value();
+        CHECK(atlas.getTexture(entry.pageIndex).isSmooth());
+    }
+
+    SECTION("Move semantics")
+    {
+        auto movedAtlas = sf::TextureAtlas::create(graphicsContext).value();
+        (void)movedAtlas.add(sf::Image::create({4u, 4u}, sf::Color::White).value());
+
+        const sf::TextureAtlas atlas = SFML_BASE_MOVE(movedAtlas);
+        CHECK(atlas.getPageCount() == 1u);
+    }
+}
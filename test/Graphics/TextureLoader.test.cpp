@@ -0,0 +1,122 @@
+#include "SFML/Graphics/TextureLoader.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/System/Path.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::TextureLoader" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::TextureLoader));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextureLoader));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TextureLoader));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TextureLoader));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::TextureLoader));
+    }
+
+    SECTION("Empty loader")
+    {
+        sf::TextureLoader loader(graphicsContext, 2);
+        CHECK(loader.getTotalCount() == 0);
+        CHECK(loader.isFinished());
+        CHECK(loader.update(sf::milliseconds(1)) == 0);
+    }
+
+    SECTION("Load a batch")
+    {
+        sf::TextureLoader loader(graphicsContext, 2);
+
+        std::size_t lastProcessedCount = 0;
+        std::size_t progressCallCount  = 0;
+        std::size_t completionCount    = 0;
+        std::size_t completionFailures = 0;
+
+        loader.setProgressCallback(
+            [&](std::size_t processedCount, std::size_t totalCount)
+            {
+                lastProcessedCount = processedCount;
+                ++progressCallCount;
+                CHECK(totalCount == loader.getTotalCount());
+            });
+
+        loader.setCompletionCallback(
+            [&](std::size_t failedCount)
+            {
+                completionFailures = failedCount;
+                ++completionCount;
+            });
+
+        const std::size_t png     = loader.enqueue("Graphics/sfml-logo-big.png");
+        const std::size_t jpg     = loader.enqueue("Graphics/sfml-logo-big.jpg");
+        const std::size_t bmp     = loader.enqueue("Graphics/sfml-logo-big.bmp", /* sRgb */ true);
+        const std::size_t missing = loader.enqueue("Graphics/does-not-exist.png");
+
+        CHECK(png == 0);
+        CHECK(missing == 3);
+        CHECK(loader.getTotalCount() == 4);
+        CHECK(loader.getStatus(png) == sf::TextureLoader::Status::Pending);
+        CHECK(!loader.takeTexture(png).hasValue());
+
+        // A zero budget still creates a texture per call, once decoded
+        while (!loader.isFinished())
+            (void)loader.update(sf::Time::Zero);
+
+        CHECK(loader.getProcessedCount() == 4);
+        CHECK(lastProcessedCount == 4);
+        CHECK(progressCallCount == 4);
+        CHECK(completionCount == 1);
+        CHECK(completionFailures == 1);
+        CHECK(loader.update(sf::milliseconds(1)) == 0);
+
+        CHECK(loader.getStatus(png) == sf::TextureLoader::Status::Loaded);
+        CHECK(loader.getStatus(jpg) == sf::TextureLoader::Status::Loaded);
+        CHECK(loader.getStatus(bmp) == sf::TextureLoader::Status::Loaded);
+        CHECK(loader.getStatus(missing) == sf::TextureLoader::Status::Failed);
+
+        const auto texture = loader.takeTexture(png).value();
+        CHECK(texture.getSize() == sf::Vector2u{1001, 304});
+        CHECK(!texture.isSrgb());
+        CHECK(loader.getStatus(png) == sf::TextureLoader::Status::Taken);
+        CHECK(!loader.takeTexture(png).hasValue());
+
+        CHECK(loader.takeTexture(bmp).value().isSrgb());
+        CHECK(!loader.takeTexture(missing).hasValue());
+
+        // Requesting more textures completes the batch again
+        (void)loader.enqueue("Graphics/sfml-logo-big.gif");
+        CHECK(!loader.isFinished());
+
+        while (!loader.isFinished())
+            (void)loader.update(sf::milliseconds(1));
+
+        CHECK(completionCount == 2);
+        CHECK(lastProcessedCount == 5);
+        CHECK(progressCallCount == 5);
+        CHECK(loader.getStatus(4) == sf::TextureLoader::Status::Loaded);
+    }
+
+    SECTION("Destruction with pending requests")
+    {
+        sf::TextureLoader loader(graphicsContext, 1);
+
+        for (int i = 0; i < 8; ++i)
+            (void)loader.enqueue("Graphics/sfml-logo-big.png");
+
+        (void)loader.update(sf::Time::Zero);
+        CHECK(!loader.isFinished());
+    }
+}
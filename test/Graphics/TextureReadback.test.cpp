@@ -0,0 +1,101 @@
+#include "SFML/Graphics/TextureReadback.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::TextureReadback" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::TextureReadback));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextureReadback));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TextureReadback));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TextureReadback));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::TextureReadback));
+    }
+
+    SECTION("Texture")
+    {
+        constexpr std::uint8_t pixels[] = {0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF};
+
+        auto texture = sf::Texture::create(graphicsContext, {1, 2}).value();
+        texture.update(pixels);
+
+        auto readback = texture.copyToImageAsync();
+        CHECK(readback.getSize() == sf::Vector2u{1, 2});
+
+        // Later changes don't affect the pixels being read back
+        texture.update(sf::Image::create({1, 2}, sf::Color::Red).value());
+
+        const auto image = readback.takeImage().value();
+        CHECK(readback.isReady());
+        CHECK(image.getSize() == sf::Vector2u{1, 2});
+        CHECK(image.getPixel({0, 0}) == sf::Color::Yellow);
+        CHECK(image.getPixel({0, 1}) == sf::Color::Cyan);
+
+        // The pixels can only be taken once
+        CHECK(!readback.takeImage().hasValue());
+    }
+
+    SECTION("Single channel texture")
+    {
+        constexpr std::uint8_t values[]{0, 64, 255, 128, 32, 16};
+
+        auto texture = sf::Texture::createSingleChannel(graphicsContext, {3, 2}).value();
+        texture.update(values);
+
+        const auto image = texture.copyToImageAsync().takeImage().value();
+        CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+        CHECK(image.getPixel({2, 0}) == sf::Color::White);
+        CHECK(image.getPixel({0, 1}) == sf::Color(255, 255, 255, 128));
+        CHECK(image.getPixel({2, 1}) == sf::Color(255, 255, 255, 16));
+    }
+
+    SECTION("Render texture")
+    {
+        const auto topTexture = sf::Texture::loadFromImage(graphicsContext,
+                                                           sf::Image::create({64, 32}, sf::Color::Green).value())
+                                    .value();
+
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {64, 64}).value();
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.draw(sf::Sprite(topTexture.getRect()), topTexture);
+        renderTexture.display();
+
+        auto readback = renderTexture.getTexture().copyToImageAsync();
+
+        // Render textures store their rows bottom to top, the image must match the synchronous copy
+        const auto expected = renderTexture.getTexture().copyToImage();
+        const auto image    = readback.takeImage().value();
+        REQUIRE(image.getSize() == expected.getSize());
+        CHECK(image.getPixel({10, 10}) == sf::Color::Green);
+        CHECK(image.getPixel({10, 50}) == sf::Color::Blue);
+        CHECK(image.getPixel({10, 50}) == expected.getPixel({10, 50}));
+        CHECK(image.getPixel({10, 10}) == expected.getPixel({10, 10}));
+    }
+
+    SECTION("Move semantics")
+    {
+        auto texture = sf::Texture::loadFromImage(graphicsContext, sf::Image::create({4, 4}, sf::Color::Red).value())
+                           .value();
+
+        auto                movedReadback = texture.copyToImageAsync();
+        sf::TextureReadback readback      = SFML_BASE_MOVE(movedReadback);
+        CHECK(!movedReadback.takeImage().hasValue()); // NOLINT(bugprone-use-after-move)
+        CHECK(readback.takeImage().value().getPixel({3, 3}) == sf::Color::Red);
+    }
+}
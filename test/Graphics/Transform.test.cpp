@@ -32,7 +32,8 @@ TEST_CASE("[Graphics] sf::Transform")
         SECTION("3x3 matrix constructor")
         {
             constexpr sf::Transform transform(10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
-            const std::vector       matrix(transform.getMatrix(), transform.getMatrix() + 16);
+            std::vector<float>      matrix(16);
+            transform.getMatrix(matrix.data());
             CHECK(matrix ==
                   std::vector{10.0f, 13.0f, 0.0f, 0.0f, 11.0f, 14.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 12.0f, 15.0f, 0.0f, 1.0f});
         }
@@ -40,7 +41,8 @@ TEST_CASE("[Graphics] sf::Transform")
 
     SECTION("Identity matrix")
     {
-        const std::vector matrix(sf::Transform::Identity.getMatrix(), sf::Transform::Identity.getMatrix() + 16);
+        std::vector<float> matrix(16);
+        sf::Transform::Identity.getMatrix(matrix.data());
         CHECK(matrix ==
               std::vector{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f});
     }
@@ -0,0 +1,88 @@
+#include "SFML/Graphics/UniformBuffer.hpp"
+
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/VertexBuffer.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::UniformBuffer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::UniformBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::UniformBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::UniformBuffer));
+    }
+
+    // Skip tests if vertex buffers aren't available
+    if (!sf::VertexBuffer::isAvailable(graphicsContext))
+        return;
+
+    SECTION("Construction")
+    {
+        const sf::UniformBuffer uniformBuffer(graphicsContext);
+        CHECK(uniformBuffer.getSize() == 0);
+        CHECK(uniformBuffer.getNativeHandle() == 0);
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer(graphicsContext);
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        struct Block
+        {
+            float values[8];
+        };
+
+        sf::UniformBuffer uniformBuffer(graphicsContext);
+        const Block       block{};
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(!uniformBuffer.update(block));
+        }
+
+        CHECK(uniformBuffer.create(sizeof(Block)));
+
+        SECTION("Null data")
+        {
+            CHECK(!uniformBuffer.update(nullptr, sizeof(Block)));
+        }
+
+        SECTION("Size + offset too large")
+        {
+            CHECK(!uniformBuffer.update(block.values, sizeof(float) * 4, sizeof(float) * 6));
+        }
+
+        CHECK(uniformBuffer.update(block));
+        CHECK(uniformBuffer.update(block.values, sizeof(float) * 4, sizeof(float) * 4));
+        CHECK(uniformBuffer.getSize() == sizeof(Block));
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer uniformBuffer1(graphicsContext);
+        CHECK(uniformBuffer1.create(32));
+        const unsigned int handle = uniformBuffer1.getNativeHandle();
+
+        sf::UniformBuffer uniformBuffer2(SFML_BASE_MOVE(uniformBuffer1));
+        CHECK(uniformBuffer2.getNativeHandle() == handle);
+        CHECK(uniformBuffer2.getSize() == 32);
+        CHECK(uniformBuffer1.getNativeHandle() == 0); // NOLINT(bugprone-use-after-move)
+    }
+}
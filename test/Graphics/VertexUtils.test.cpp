@@ -0,0 +1,84 @@
+#include "SFML/Graphics/VertexUtils.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include <Doctest.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::transformVertices")
+{
+    sf::Transform transform;
+    transform.translate({10.f, -20.f}).rotate(sf::degrees(30)).scale({2.f, 0.5f});
+
+    const auto makeVertices = [](std::size_t count)
+    {
+        std::vector<sf::Vertex> vertices(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto value = static_cast<float>(i);
+            vertices[i]      = {{value * 3.f - 7.f, 5.f - value},
+                                sf::Color(static_cast<std::uint8_t>(i * 20), 64, 128, static_cast<std::uint8_t>(255 - i)),
+                                {value, value * 2.f}};
+        }
+
+        return vertices;
+    };
+
+    const auto checkTransformed = [&](const std::vector<sf::Vertex>& result, const std::vector<sf::Vertex>& input)
+    {
+        for (std::size_t i = 0; i < input.size(); ++i)
+        {
+            CHECK(result[i].position == Approx(transform.transformPoint(input[i].position)));
+            CHECK(result[i].color == input[i].color);
+            CHECK(result[i].texCoords == input[i].texCoords);
+        }
+    };
+
+    SECTION("Counts covering the scalar tail of the vectorized implementations")
+    {
+        for (std::size_t count = 0; count <= 9; ++count)
+        {
+            const std::vector<sf::Vertex> input = makeVertices(count);
+
+            // The vertex after the output range must not be written
+            std::vector<sf::Vertex> output(count + 1, sf::Vertex{{-1.f, -1.f}, sf::Color::Magenta, {-1.f, -1.f}});
+            sf::transformVertices(transform, input.data(), output.data(), count);
+
+            checkTransformed(output, input);
+            CHECK(output[count].position == sf::Vector2f{-1.f, -1.f});
+            CHECK(output[count].color == sf::Color::Magenta);
+        }
+    }
+
+    SECTION("In place")
+    {
+        for (std::size_t count = 0; count <= 9; ++count)
+        {
+            const std::vector<sf::Vertex> input    = makeVertices(count);
+            std::vector<sf::Vertex>       vertices = input;
+            sf::transformVertices(transform, vertices.data(), vertices.data(), count);
+
+            checkTransformed(vertices, input);
+        }
+    }
+
+    SECTION("Identity")
+    {
+        const std::vector<sf::Vertex> input = makeVertices(7);
+        std::vector<sf::Vertex>       output(7);
+
+        sf::transformVertices(sf::Transform::Identity, input.data(), output.data(), input.size());
+
+        for (std::size_t i = 0; i < input.size(); ++i)
+            CHECK(output[i].position == input[i].position);
+    }
+}
@@ -82,7 +82,8 @@ std::ostream& operator<<(std::ostream& os, Color color)
 
 std::ostream& operator<<(std::ostream& os, const Transform& transform)
 {
-    const auto& matrix = transform.getMatrix();
+    float matrix[16];
+    transform.getMatrix(matrix);
     os << matrix[0] << ", " << matrix[4] << ", " << matrix[12] << ", ";
     os << matrix[1] << ", " << matrix[5] << ", " << matrix[13] << ", ";
     os << matrix[3] << ", " << matrix[7] << ", " << matrix[15];
@@ -105,13 +106,12 @@ template std::ostream& operator<<(std::ostream&, const Rect<float>&);
 
 bool operator==(const sf::Transform& lhs, const Approx<sf::Transform>& rhs)
 {
-    return lhs.getMatrix()[0] == Approx(rhs.value.getMatrix()[0]) &&
-           lhs.getMatrix()[4] == Approx(rhs.value.getMatrix()[4]) &&
-           lhs.getMatrix()[12] == Approx(rhs.value.getMatrix()[12]) &&
-           lhs.getMatrix()[1] == Approx(rhs.value.getMatrix()[1]) &&
-           lhs.getMatrix()[5] == Approx(rhs.value.getMatrix()[5]) &&
-           lhs.getMatrix()[13] == Approx(rhs.value.getMatrix()[13]) &&
-           lhs.getMatrix()[3] == Approx(rhs.value.getMatrix()[3]) &&
-           lhs.getMatrix()[7] == Approx(rhs.value.getMatrix()[7]) &&
-           lhs.getMatrix()[15] == Approx(rhs.value.getMatrix()[15]);
+    float lhsMatrix[16];
+    float rhsMatrix[16];
+    lhs.getMatrix(lhsMatrix);
+    rhs.value.getMatrix(rhsMatrix);
+
+    return lhsMatrix[0] == Approx(rhsMatrix[0]) && lhsMatrix[4] == Approx(rhsMatrix[4]) &&
+           lhsMatrix[12] == Approx(rhsMatrix[12]) && lhsMatrix[1] == Approx(rhsMatrix[1]) &&
+           lhsMatrix[5] == Approx(rhsMatrix[5]) && lhsMatrix[13] == Approx(rhsMatrix[13]);
 }